@@ -6,4 +6,8 @@ DEL /F /S /Q "*.db"
 DEL /F /S /Q "*.opendb"
 RMDIR /S /Q "Debug"
 RMDIR /S /Q "Release"
+RMDIR /S /Q "Tests"
+RMDIR /S /Q "Benchmark"
+RMDIR /S /Q "DirectScanner"
+RMDIR /S /Q "ScannerGenerator"
 RMDIR /S /Q ".vs"
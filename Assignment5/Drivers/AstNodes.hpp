@@ -15,6 +15,8 @@
 
 // You must implement the base virtual Visitor class
 class Visitor;
+class SourceFile;
+class ConstantPool;
 
 // Forward declarations of all the node types
 class AbstractNode;
@@ -76,6 +78,11 @@ public:
   // ClassNode / VariableNode / FunctionNode
   unique_vector<AbstractNode> mGlobals;
 
+  // The file the tokens point into (null when parsed from text the caller keeps alive)
+  std::shared_ptr<const SourceFile> mSource;
+  // The decoded string literals of the tree, filled in by InterpreterPrePass (literal values point into it)
+  std::shared_ptr<ConstantPool> mConstants;
+
   void Walk(Visitor* visitor, bool visit = true) override;
 };
 
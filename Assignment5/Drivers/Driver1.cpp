@@ -115,16 +115,21 @@ void TokenizeAndDeleteRoot(DfaState* root, const char* stream, const char* token
     Token token;
     reader(root, stream, token);
     
-    std::string escapedText;
-    for (size_t i = 0; i < token.mLength; ++i)
-      escapedText += Escape(token.mText[i]);
+    bool tracing = IsDiagnosticSinkEnabled();
+    if (tracing)
+    {
+      std::string escapedText;
+      for (size_t i = 0; i < token.mLength; ++i)
+        escapedText += Escape(token.mText[i]);
 
-    printf("Token: '%s' of type %d (%s)\n", escapedText.c_str(), token.mTokenType, tokenNames[token.mTokenType]);
+      WriteDiagnostic("Token: '" + escapedText + "' of type " + std::to_string(token.mTokenType) + " (" + tokenNames[token.mTokenType] + ")\n");
+    }
     stream += token.mLength;
 
     if (token.mLength == 0)
     {
-      printf("Skipping one character of input: '%s'\n", Escape(*stream));
+      if (tracing)
+        WriteDiagnostic(std::string("Skipping one character of input: '") + Escape(*stream) + "'\n");
       ++stream;
     }
     else if (tokensOut != nullptr)
@@ -7,6 +7,7 @@
 #ifndef COMPILER_CLASS_DRIVER_1
 #define COMPILER_CLASS_DRIVER_1
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -55,6 +56,17 @@ public:
     int mTokenType;
     TokenType::Enum mEnumTokenType;
   };
+
+  // Filled in by the language scanner (after the type it fits in what would otherwise be padding):
+  // the atom of an identifier's interned name, so names are hashed once when they are scanned, or the value of an
+  // integer, float or character literal, so literals are decoded once. Tokens made any other way leave it 0,
+  // and a 0 is always worked out again from the text (which for a literal gives back the same value)
+  union
+  {
+    uint32_t mAtom = 0;
+    int mIntegerValue;
+    float mFloatValue;
+  };
 };
 
 // You must implement this state in your own code
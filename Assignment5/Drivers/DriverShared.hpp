@@ -8,6 +8,7 @@
 #define COMPILER_CLASS_DRIVER_SHARED
 
 #include <memory>
+#include <string>
 #include <vector>
 #include <unordered_map>
 
@@ -35,4 +36,9 @@ typedef void (*RunWithInputFn)(const char* input);
 
 int DriverMain(int argc, char* argv[], DriverTestFn tests[], size_t testCount);
 
+// Tracing output (tokens read, symbol tables, ...) goes to the diagnostic sink the user code provides
+// Check it's enabled before building any text, since the sink may drop everything
+bool IsDiagnosticSinkEnabled();
+void WriteDiagnostic(const std::string& text);
+
 #endif
@@ -21,10 +21,11 @@ Symbol::~Symbol()
 
 void Symbol::Print(size_t depth)
 {
+  std::string line;
   for (size_t i = 0; i < depth; ++i)
-    printf("| ");
+    line += "| ";
 
-  printf("%s\n", Dump().c_str());
+  WriteDiagnostic(line + Dump() + "\n");
 }
 
 std::ostream& operator<<(std::ostream& stream, const Symbol* symbol)
@@ -131,6 +132,9 @@ std::string Type::Dump()
 
 void Library::Print()
 {
+  if (!IsDiagnosticSinkEnabled())
+    return;
+
   for (Symbol* symbol : mGlobals)
     symbol->Print();
 }
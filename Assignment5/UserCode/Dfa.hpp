@@ -0,0 +1,151 @@
+#pragma once
+
+#include "../Drivers/Driver1.hpp"
+#include "DfaLoop.hpp"
+
+#include <cstdint>
+#include <stdio.h>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+const char cDefaultEdgeId = -1;
+
+class DfaTable;
+class CompiledDfaTable;
+
+class DfaState
+{
+public:
+  int mAcceptingToken = 0;
+  std::unordered_map<char, DfaState*> mEdges;
+
+  // Only set on a root state, either by compiling its graph (see CompileDfa) or by pointing at a shared table
+  const DfaTable* mTable = nullptr;
+  std::unique_ptr<CompiledDfaTable> mOwnedTable;
+
+  DfaState* Find(char value)
+  {
+    auto it = mEdges.find(value);
+    if (it == mEdges.end())
+      it = mEdges.find(cDefaultEdgeId);
+
+    if (it == mEdges.end())
+      return nullptr;
+    return it->second;
+  }
+};
+
+// A frozen copy of a DfaState graph laid out as one flat transition table
+// Bytes that every state treats identically (for example all the digits, or everything that only
+// hits default edges, including high-bit/UTF-8 bytes) are merged into one byte class,
+// so each row only holds one entry per class and reading a token costs two loads per input byte
+// States that loop on themselves also carry a DfaLoop so long runs can be skipped with vector compares
+class DfaTable
+{
+public:
+  // State 0 is the dead state (no transition) and state 1 is always the starting state
+  static const uint16_t cDeadState = 0;
+  static const uint16_t cStartState = 1;
+  static const size_t cAlphabetSize = 256;
+  static const size_t cMaxStates = 0xFFFF;
+
+  constexpr DfaTable(size_t stateCount, size_t classCount, const uint8_t* byteClasses, const uint16_t* transitions,
+    const int* acceptingTokens, const DfaLoop* loops) :
+    mStateCount(stateCount),
+    mClassCount(classCount),
+    mByteClasses(byteClasses),
+    mTransitions(transitions),
+    mAcceptingTokens(acceptingTokens),
+    mLoops(loops)
+  {
+  }
+
+  uint16_t Next(uint16_t state, char value) const
+  {
+    return mTransitions[state * mClassCount + mByteClasses[(unsigned char)value]];
+  }
+
+  // The memory used by the tables that are touched while scanning
+  size_t GetSizeInBytes() const
+  {
+    return cAlphabetSize * sizeof(uint8_t) + mStateCount * mClassCount * sizeof(uint16_t) +
+      mStateCount * (sizeof(int) + sizeof(DfaLoop));
+  }
+
+  size_t mStateCount;
+  size_t mClassCount;
+  // Maps each byte to its class
+  const uint8_t* mByteClasses;
+  // mStateCount rows of mClassCount entries
+  const uint16_t* mTransitions;
+  // The token each state accepts (0 if the state is not accepting)
+  const int* mAcceptingTokens;
+  // The self loop of each state (DfaLoop::None for most states)
+  const DfaLoop* mLoops;
+};
+
+// A DfaTable that owns its arrays (built at runtime by CompileDfa)
+class CompiledDfaTable : public DfaTable
+{
+public:
+  CompiledDfaTable(size_t stateCount, size_t classCount) :
+    DfaTable(stateCount, classCount, nullptr, nullptr, nullptr, nullptr),
+    mByteClassStorage(),
+    mTransitionStorage(stateCount * classCount, uint16_t(cDeadState)),
+    mAcceptingTokenStorage(stateCount, 0),
+    mLoopStorage(stateCount)
+  {
+    mByteClasses = mByteClassStorage;
+    mTransitions = mTransitionStorage.data();
+    mAcceptingTokens = mAcceptingTokenStorage.data();
+    mLoops = mLoopStorage.data();
+  }
+
+  CompiledDfaTable(const CompiledDfaTable&) = delete;
+  CompiledDfaTable& operator=(const CompiledDfaTable&) = delete;
+
+  uint8_t mByteClassStorage[cAlphabetSize];
+  std::vector<uint16_t> mTransitionStorage;
+  std::vector<int> mAcceptingTokenStorage;
+  std::vector<DfaLoop> mLoopStorage;
+};
+
+// The size of a DfaState graph (only counting states reachable from the root)
+class DfaStatistics
+{
+public:
+  size_t mStateCount = 0;
+  size_t mEdgeCount = 0;
+};
+
+// What MinimizeDfa did to a graph
+class DfaMinimizeReport
+{
+public:
+  void Print() const
+  {
+    printf("States: %d -> %d\n", (int)mBefore.mStateCount, (int)mAfter.mStateCount);
+    printf("Edges: %d -> %d\n", (int)mBefore.mEdgeCount, (int)mAfter.mEdgeCount);
+  }
+
+  DfaStatistics mBefore;
+  DfaStatistics mAfter;
+};
+
+DfaStatistics GetDfaStatistics(DfaState* root);
+
+// Merges all equivalent states reachable from the root (Hopcroft's partition refinement)
+// Accepting states only merge with states that accept the same token, so the language and every token id are preserved
+// Merged away states are deleted, so no pointers to states other than the root may be held across this call
+DfaMinimizeReport MinimizeDfa(DfaState* root);
+
+// Freezes the graph reachable from the root into a table owned by the root
+// The graph must not be modified afterwards (ReadToken will keep using the old table)
+// Returns false if the graph is too large to be compiled, in which case ReadToken walks the graph
+bool CompileDfa(DfaState* root);
+
+// Reads a token using only the compiled table (same results as ReadToken on the original graph)
+// Returns how many characters the automaton consumed before it stopped, which can be more than the token's length
+// (the character after those was also looked at, unless it was the null terminator)
+size_t ReadTableToken(const DfaTable& table, const char* stream, Token& outToken);
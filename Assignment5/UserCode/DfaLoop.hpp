@@ -0,0 +1,198 @@
+#pragma once
+
+#include <cstdint>
+#include <stddef.h>
+#include "Simd.hpp"
+
+// The bytes that keep a state in itself, for states that loop on themselves (whitespace runs, identifier bodies,
+// comment bodies, string bodies, ...). While a table scanner sits in such a state it can skip the whole run
+// with vector compares (16 or 32 bytes per step) instead of taking one transition per byte
+class DfaLoop
+{
+public:
+  enum Kind : uint8_t
+  {
+    // Not a looping state (or the loop is too irregular to describe)
+    None,
+    // The state loops on every byte inside one of the ranges [mLow[i], mHigh[i]]
+    StayRanges,
+    // The state loops on every byte except the ones in mLow (which always includes the null terminator)
+    StopBytes
+  };
+
+  static const size_t cMaxRanges = 4;
+  static const size_t cMaxStopBytes = 4;
+
+  constexpr DfaLoop() :
+    mKind(None),
+    mCount(0),
+    mLow(),
+    mHigh()
+  {
+  }
+
+  constexpr bool Stays(unsigned char value) const
+  {
+    if (mKind == StayRanges)
+    {
+      for (size_t i = 0; i < mCount; ++i)
+      {
+        if (value >= mLow[i] && value <= mHigh[i])
+          return true;
+      }
+      return false;
+    }
+    if (mKind == StopBytes)
+    {
+      for (size_t i = 0; i < mCount; ++i)
+      {
+        if (value == mLow[i])
+          return false;
+      }
+      return true;
+    }
+    return false;
+  }
+
+  // Returns the index of the first byte at or after 'index' that leaves the state (at the latest, the null terminator)
+  // Vector loads are aligned so they never cross into a page past the end of the stream, but they may
+  // read a few bytes past the null terminator within the same block
+  size_t Skip(const char* stream, size_t index) const;
+
+  uint8_t mKind;
+  uint8_t mCount;
+  uint8_t mLow[cMaxRanges];
+  uint8_t mHigh[cMaxRanges];
+};
+
+// Describes the self loop of a state from its row of a byte class table (see DfaTable)
+// The null terminator is never part of a loop since scanning always stops there
+constexpr DfaLoop FindDfaLoop(const uint16_t* row, size_t classCount, const uint8_t* byteClasses, uint16_t state)
+{
+  DfaLoop loop;
+  bool loops = false;
+  for (size_t c = 0; c < classCount && !loops; ++c)
+    loops = row[c] == state;
+  if (!loops)
+    return loop;
+
+  bool stays[256] = {};
+  size_t stayCount = 0;
+  size_t rangeCount = 0;
+  for (size_t c = 1; c < 256; ++c)
+  {
+    stays[c] = row[byteClasses[c]] == state;
+    if (stays[c])
+    {
+      ++stayCount;
+      if (!stays[c - 1])
+        ++rangeCount;
+    }
+  }
+
+  if (rangeCount <= DfaLoop::cMaxRanges)
+  {
+    loop.mKind = DfaLoop::StayRanges;
+    for (size_t c = 1; c < 256; ++c)
+    {
+      if (stays[c] && !stays[c - 1])
+        loop.mLow[loop.mCount] = (uint8_t)c;
+      if (stays[c] && (c == 255 || !stays[c + 1]))
+        loop.mHigh[loop.mCount++] = (uint8_t)c;
+    }
+  }
+  else if (256 - stayCount <= DfaLoop::cMaxStopBytes)
+  {
+    loop.mKind = DfaLoop::StopBytes;
+    for (size_t c = 0; c < 256; ++c)
+    {
+      if (!stays[c])
+        loop.mLow[loop.mCount++] = (uint8_t)c;
+    }
+  }
+  return loop;
+}
+
+inline size_t DfaLoop::Skip(const char* stream, size_t index) const
+{
+#if SIMD_AVX2 || SIMD_SSE2
+#if SIMD_AVX2
+  typedef __m256i Vector;
+  const size_t cVectorSize = 32;
+#else
+  typedef __m128i Vector;
+  const size_t cVectorSize = 16;
+#endif
+
+  // Walk byte by byte until the stream is aligned (this also covers short runs without touching vectors)
+  while (((uintptr_t)(stream + index) & (cVectorSize - 1)) != 0)
+  {
+    if (!Stays((unsigned char)stream[index]))
+      return index;
+    ++index;
+  }
+
+  Vector lows[cMaxRanges];
+  Vector spans[cMaxRanges];
+  for (size_t i = 0; i < mCount; ++i)
+  {
+#if SIMD_AVX2
+    lows[i] = _mm256_set1_epi8((char)mLow[i]);
+    spans[i] = _mm256_set1_epi8((char)(mHigh[i] - mLow[i]));
+#else
+    lows[i] = _mm_set1_epi8((char)mLow[i]);
+    spans[i] = _mm_set1_epi8((char)(mHigh[i] - mLow[i]));
+#endif
+  }
+
+  for (;;)
+  {
+    const Vector* block = (const Vector*)(stream + index);
+    uint32_t leaving = 0;
+#if SIMD_AVX2
+    Vector bytes = _mm256_load_si256(block);
+    Vector matches = _mm256_setzero_si256();
+    for (size_t i = 0; i < mCount; ++i)
+    {
+      if (mKind == StayRanges)
+      {
+        // value - low <= high - low (unsigned) means the value is inside the range
+        Vector offset = _mm256_sub_epi8(bytes, lows[i]);
+        matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(_mm256_max_epu8(offset, spans[i]), spans[i]));
+      }
+      else
+      {
+        matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(bytes, lows[i]));
+      }
+    }
+    uint32_t mask = (uint32_t)_mm256_movemask_epi8(matches);
+    leaving = mKind == StayRanges ? ~mask : mask;
+#else
+    Vector bytes = _mm_load_si128(block);
+    Vector matches = _mm_setzero_si128();
+    for (size_t i = 0; i < mCount; ++i)
+    {
+      if (mKind == StayRanges)
+      {
+        // value - low <= high - low (unsigned) means the value is inside the range
+        Vector offset = _mm_sub_epi8(bytes, lows[i]);
+        matches = _mm_or_si128(matches, _mm_cmpeq_epi8(_mm_max_epu8(offset, spans[i]), spans[i]));
+      }
+      else
+      {
+        matches = _mm_or_si128(matches, _mm_cmpeq_epi8(bytes, lows[i]));
+      }
+    }
+    uint32_t mask = (uint32_t)_mm_movemask_epi8(matches);
+    leaving = (mKind == StayRanges ? ~mask : mask) & 0xFFFF;
+#endif
+    if (leaving != 0)
+      return index + CountTrailingZeros(leaving);
+    index += cVectorSize;
+  }
+#else
+  while (Stays((unsigned char)stream[index]))
+    ++index;
+  return index;
+#endif
+}
@@ -0,0 +1,38 @@
+/******************************************************************\
+ * Author:
+ * Copyright 2015, DigiPen Institute of Technology
+\******************************************************************/
+#include "../Drivers/DriverShared.hpp"
+#include "DiagnosticSink.hpp"
+
+static DiagnosticSink& GetDefaultDiagnosticSink()
+{
+#if DRIVER1 || DRIVER2 || DRIVER3 || DRIVER4 || DRIVER5
+  static FileDiagnosticSink sink(stdout);
+#else
+  static NullDiagnosticSink sink;
+#endif
+  return sink;
+}
+
+static DiagnosticSink* sCurrentSink = nullptr;
+
+DiagnosticSink& GetDiagnosticSink()
+{
+  return sCurrentSink != nullptr ? *sCurrentSink : GetDefaultDiagnosticSink();
+}
+
+void SetDiagnosticSink(DiagnosticSink* sink)
+{
+  sCurrentSink = sink;
+}
+
+bool IsDiagnosticSinkEnabled()
+{
+  return GetDiagnosticSink().IsEnabled();
+}
+
+void WriteDiagnostic(const std::string& text)
+{
+  GetDiagnosticSink().Write(text);
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <stdio.h>
+#include <string>
+
+// Where tracing output (parse rules, symbol trees, ...) goes
+// Tracing code asks IsEnabled first, so with a null sink nothing is formatted or built at all
+class DiagnosticSink
+{
+public:
+  virtual ~DiagnosticSink() {}
+
+  virtual bool IsEnabled() const
+  {
+    return true;
+  }
+
+  virtual void Write(const char* text, size_t length) = 0;
+
+  void Write(const std::string& text)
+  {
+    Write(text.data(), text.size());
+  }
+};
+
+// Drops everything
+class NullDiagnosticSink : public DiagnosticSink
+{
+public:
+  bool IsEnabled() const override
+  {
+    return false;
+  }
+
+  void Write(const char*, size_t) override
+  {
+  }
+};
+
+// Keeps everything in memory until it is read or flushed
+class BufferedDiagnosticSink : public DiagnosticSink
+{
+public:
+  void Write(const char* text, size_t length) override
+  {
+    mText.append(text, length);
+  }
+
+  const std::string& GetText() const
+  {
+    return mText;
+  }
+
+  // Writes everything kept so far to the file (in one call) and clears it
+  void Flush(FILE* file)
+  {
+    fwrite(mText.data(), 1, mText.size(), file);
+    mText.clear();
+  }
+
+  void Clear()
+  {
+    mText.clear();
+  }
+
+private:
+  std::string mText;
+};
+
+// Writes straight to a file (stdout by default), going through the same buffer as printf
+class FileDiagnosticSink : public DiagnosticSink
+{
+public:
+  explicit FileDiagnosticSink(FILE* file = stdout) :
+    mFile(file)
+  {
+  }
+
+  void Write(const char* text, size_t length) override
+  {
+    fwrite(text, 1, length, mFile);
+  }
+
+private:
+  FILE* mFile;
+};
+
+// The sink all tracing goes to. The driver builds (DRIVER1 to DRIVER5) start out writing to stdout so their output is
+// exactly what the tests expect, every other build starts out with a null sink so tracing costs nothing
+DiagnosticSink& GetDiagnosticSink();
+
+// The sink must outlive its use, passing null goes back to the default sink
+void SetDiagnosticSink(DiagnosticSink* sink);
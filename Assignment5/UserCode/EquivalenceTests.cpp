@@ -0,0 +1,988 @@
+/******************************************************************\
+ * Author:
+ * Copyright 2015, DigiPen Institute of Technology
+\******************************************************************/
+#include "../Drivers/Driver1.hpp"
+#include "../Drivers/Driver4.hpp"
+#include "../Drivers/Driver5.hpp"
+
+#include <algorithm>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "DiagnosticSink.hpp"
+#include "FlatAst.hpp"
+#include "LanguageScanner.hpp"
+#include "Literals.hpp"
+#include "Parser.hpp"
+#include "ScannerGenerator.hpp"
+#include "SourceFile.hpp"
+#include "StaticDfa.hpp"
+#include "Tokenizer.hpp"
+#include "Visitor.hpp"
+
+#if EQUIVALENCE_TESTS
+
+// Randomized checks that each fast path produces exactly what the plain code it stands in for produces
+// Every test prints its first mismatch and returns false, and the same seed always generates the same inputs
+
+typedef std::mt19937 Random;
+
+static bool SameTokens(const std::vector<Token>& expected, const std::vector<Token>& actual)
+{
+  if (expected.size() != actual.size())
+    return false;
+  for (size_t i = 0; i < expected.size(); ++i)
+  {
+    if (expected[i].mText != actual[i].mText || expected[i].mLength != actual[i].mLength ||
+      expected[i].mTokenType != actual[i].mTokenType)
+      return false;
+  }
+  return true;
+}
+
+// Source text of at least the length, made of random pieces
+template <size_t PieceCount>
+static std::string GenerateText(Random& random, const char* const (&pieces)[PieceCount], size_t length)
+{
+  std::string text;
+  while (text.size() < length)
+    text += pieces[random() % PieceCount];
+  return text;
+}
+
+// TokenizeStreamParallel against TokenizeStream, on streams large enough to be split, where chunks often start
+// inside comments, strings and unterminated tokens
+static bool TestParallelTokenize(Random& random)
+{
+  static const char* const cPieces[] =
+  {
+    " ", "\n", "\r\n", "\t", "abc ", "/* long\n comment */", "// line comment\n", "\"str\\\"ing\"", "'c'", "1.5e+3f",
+    "==", "/", "*", "\"unterminated\n", "@", "#",
+  };
+  const DfaTable& table = GetStaticLanguageTable();
+  for (size_t trial = 0; trial < 20; ++trial)
+  {
+    std::string text = GenerateText(random, cPieces, 300000 + random() % 700000);
+    // Now and then a comment longer than a whole chunk
+    if (random() % 4 == 0)
+      text.insert(random() % text.size(), "/*" + std::string(random() % 200000, 'x') + "*/");
+
+    size_t threadCount = 2 + random() % 14;
+    std::vector<Token> expected;
+    std::vector<Token> actual;
+    TokenizeStream(table, text.c_str(), expected);
+    TokenizeStreamParallel(table, text.c_str(), actual, threadCount);
+    if (!SameTokens(expected, actual))
+    {
+      printf("  trial %zu with %zu threads: %zu tokens instead of %zu\n", trial, threadCount, actual.size(), expected.size());
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool SameTokens(const TokenBuffer& expected, const TokenBuffer& actual)
+{
+  if (expected.GetCount() != actual.GetCount())
+    return false;
+  for (size_t i = 0; i < expected.GetCount(); ++i)
+  {
+    TokenId id((uint32_t)i);
+    if (expected.GetOffset(id) != actual.GetOffset(id) || expected.GetLength(id) != actual.GetLength(id) ||
+      expected.GetType(id) != actual.GetType(id))
+      return false;
+  }
+  return true;
+}
+
+// RetokenizeEdit against tokenizing the whole edited text, over chains of random edits to small texts
+// The pieces split and join comments, strings and escapes, so edits often change tokens well before or after them
+static bool TestRetokenizeEdit(Random& random)
+{
+  static const char* const cPieces[] =
+  {
+    " ", "\n", "\t", "abc", "x", "class", " var ", "/*", "*/", "//", "\"", "'", "\\", "1.5", "e+3f", "==", "/", "*", "@",
+  };
+  const DfaTable& table = GetStaticLanguageTable();
+  for (size_t trial = 0; trial < 3000; ++trial)
+  {
+    std::string text = GenerateText(random, cPieces, random() % 200);
+    // Now and then a token too long for the buffer's 16-bit lengths
+    if (random() % 50 == 0)
+      text += std::string(70000, 'q');
+    bool skipTrivia = random() % 2 == 0;
+    TokenBuffer buffer(text.c_str());
+    TokenizeStream(table, text.c_str(), buffer, skipTrivia);
+
+    for (size_t i = 0; i < 10; ++i)
+    {
+      TokenEdit edit;
+      edit.mOffset = random() % (text.size() + 1);
+      edit.mRemovedLength = std::min<size_t>(random() % 5, text.size() - edit.mOffset);
+      std::string inserted = GenerateText(random, cPieces, random() % 8);
+      edit.mInsertedLength = inserted.size();
+      std::string edited = text.substr(0, edit.mOffset) + inserted + text.substr(edit.mOffset + edit.mRemovedLength);
+
+      RetokenizeEdit(table, edited.c_str(), edit, buffer, skipTrivia);
+      TokenBuffer expected(edited.c_str());
+      TokenizeStream(table, edited.c_str(), expected, skipTrivia);
+      if (!SameTokens(expected, buffer))
+      {
+        printf("  trial %zu edit %zu (skipping trivia %d) of \"%s\" into \"%s\"\n", trial, i, skipTrivia, text.c_str(),
+          edited.c_str());
+        return false;
+      }
+      text.swap(edited);
+      buffer.mText = text.c_str();
+    }
+  }
+  return true;
+}
+
+// Random programs that use every kind of node (they parse, but aren't meant to pass semantic analysis)
+class ProgramGenerator
+{
+public:
+  explicit ProgramGenerator(Random& random) :
+    mRandom(random)
+  {
+  }
+
+  std::string Expression(size_t depth)
+  {
+    static const char* const cValues[] =
+    {
+      "a", "b", "value", "0", "17", "2.5f", "1.5e+3f", "'c'", "'\\n'", "\"text\"", "\"say \\\"q\\\"\"", "true", "false", "null",
+    };
+    static const char* const cBinary[] =
+    {
+      "=", "+=", "-=", "*=", "/=", "%=", "||", "&&", "<", ">", "<=", ">=", "==", "!=", "+", "-", "*", "/", "%",
+    };
+    static const char* const cUnary[] = { "*", "&", "+", "-", "!", "++", "--" };
+
+    if (depth == 0)
+      return Pick(cValues);
+    switch (Pick(9))
+    {
+    case 0:
+    case 1:
+      return Expression(depth - 1) + " " + Pick(cBinary) + " " + Expression(depth - 1);
+    case 2:
+      return std::string(Pick(cUnary)) + " " + Expression(depth - 1);
+    case 3:
+      return "(" + Expression(depth - 1) + ")";
+    case 4:
+      return Expression(depth - 1) + (Pick(2) == 0 ? " . " : " -> ") + Name();
+    case 5:
+    {
+      std::string call = Expression(depth - 1) + "(";
+      for (size_t i = Pick(4); i > 0; --i)
+        call += Expression(depth - 1) + (i > 1 ? ", " : "");
+      return call + ")";
+    }
+    case 6:
+      // A cast's type would take the '*' of a multiply after it
+      return "(" + Expression(depth - 1) + " as " + Type(1) + ")";
+    case 7:
+      return Expression(depth - 1) + "[" + Expression(depth - 1) + "]";
+    default:
+      return Pick(cValues);
+    }
+  }
+
+  std::string Program()
+  {
+    std::string text;
+    for (size_t i = Pick(6); i > 0; --i)
+    {
+      size_t kind = Pick(3);
+      if (kind == 0)
+      {
+        text += "class " + Name() + " {";
+        for (size_t j = Pick(4); j > 0; --j)
+          text += Pick(2) == 0 ? Var(2) + ";" : Function(2);
+        text += "}";
+      }
+      else if (kind == 1)
+        text += Function(3);
+      else
+        text += Var(2) + ";";
+    }
+    return text;
+  }
+
+private:
+  size_t Pick(size_t count)
+  {
+    return mRandom() % count;
+  }
+
+  template <size_t Count>
+  const char* Pick(const char* const (&choices)[Count])
+  {
+    return choices[Pick(Count)];
+  }
+
+  std::string Name()
+  {
+    static const char* const cNames[] = { "a", "b", "value", "Integer", "Float", "x1" };
+    return Pick(cNames);
+  }
+
+  std::string Type(size_t depth)
+  {
+    if (depth == 0 || Pick(4) != 0)
+    {
+      std::string type = Name() + std::string(Pick(3), '*');
+      return Pick(4) == 0 ? type + "&" : type;
+    }
+    std::string type = "function" + std::string(1 + Pick(2), '*') + "(" + Type(depth - 1);
+    for (size_t i = Pick(3); i > 0; --i)
+      type += ", " + Type(depth - 1);
+    type += ")";
+    return Pick(2) == 0 ? type + " : " + Type(depth - 1) : type;
+  }
+
+  std::string Var(size_t depth)
+  {
+    std::string var = "var " + Name() + " : " + Type(1);
+    return Pick(2) == 0 ? var + " = " + Expression(depth) : var;
+  }
+
+  std::string Function(size_t depth)
+  {
+    std::string function = "function " + Name() + "(";
+    for (size_t i = Pick(4); i > 0; --i)
+      function += Name() + " : " + Type(1) + (i > 1 ? ", " : "");
+    function += ")";
+    if (Pick(2) == 0)
+      function += " : " + Type(1);
+    return function + Scope(depth);
+  }
+
+  std::string Scope(size_t depth)
+  {
+    std::string scope = "{";
+    for (size_t i = depth > 0 ? Pick(5) : 0; i > 0; --i)
+      scope += Statement(depth - 1);
+    return scope + "}";
+  }
+
+  std::string Statement(size_t depth)
+  {
+    switch (Pick(12))
+    {
+    case 0:
+      return "label " + Name() + ";";
+    case 1:
+      return "goto " + Name() + ";";
+    case 2:
+      return Pick(2) == 0 ? "return;" : "return " + Expression(depth) + ";";
+    case 3:
+      return Pick(2) == 0 ? "break;" : "continue;";
+    case 4:
+      return Var(depth) + ";";
+    case 5:
+    {
+      std::string statement = "if (" + Expression(depth) + ")" + Scope(depth);
+      for (size_t i = Pick(3); i > 0; --i)
+        statement += "else if (" + Expression(depth) + ")" + Scope(depth);
+      return Pick(2) == 0 ? statement + "else" + Scope(depth) : statement;
+    }
+    case 6:
+      return "while (" + Expression(depth) + ")" + Scope(depth);
+    case 7:
+    {
+      // Every part of the header is optional
+      std::string initial = Pick(3) == 0 ? "" : Pick(2) == 0 ? Var(depth) : Expression(depth);
+      std::string condition = Pick(3) == 0 ? "" : Expression(depth);
+      std::string iterator = Pick(3) == 0 ? "" : Expression(depth);
+      return "for (" + initial + ";" + condition + ";" + iterator + ")" + Scope(depth);
+    }
+    default:
+      return Expression(depth) + ";";
+    }
+  }
+
+  Random& mRandom;
+};
+
+// The tree as the Driver4 tests print it: before semantic analysis every symbol and type shows as (nullptr),
+// but every node, operator, name and literal is there
+static std::string PrintTreeToString(AbstractNode* node)
+{
+  BufferedDiagnosticSink sink;
+  DiagnosticSink& previous = GetDiagnosticSink();
+  SetDiagnosticSink(&sink);
+  if (node != nullptr)
+    PrintTreeWithSymbols(node);
+  SetDiagnosticSink(&previous);
+  return sink.GetText();
+}
+
+static bool SameFlatAst(const FlatAst& expected, const FlatAst& actual)
+{
+  if (expected.GetNodeCount() != actual.GetNodeCount())
+    return false;
+  for (FlatNodeId node = 0; node < expected.GetNodeCount(); ++node)
+  {
+    FlatNodeKind::Enum kind = expected.GetKind(node);
+    if (actual.GetKind(node) != kind || expected.GetSubtreeEnd(node) != actual.GetSubtreeEnd(node) ||
+      expected.GetChildCount(node) != actual.GetChildCount(node))
+      return false;
+    for (size_t slot = 0; slot < expected.GetChildCount(node); ++slot)
+    {
+      if (expected.GetChild(node, slot) != actual.GetChild(node, slot))
+        return false;
+    }
+    for (size_t i = 0; i < FlatAst::GetTokenCount(kind); ++i)
+    {
+      if (expected.GetToken(node, i).mIndex != actual.GetToken(node, i).mIndex)
+        return false;
+    }
+  }
+  return true;
+}
+
+// Parses an expression with the parser policy: the printed tree followed by where the parser stopped and whether it threw
+template <typename Policy>
+static std::string ParseExpressionToString(const std::vector<Token>& tokens)
+{
+  BasicParser<Policy> parser;
+  parser.Load(tokens);
+  std::string result;
+  try
+  {
+    std::unique_ptr<ExpressionNode> tree = parser.Expression();
+    result = PrintTreeToString(tree.get());
+  }
+  catch (ParsingException&)
+  {
+    result = "threw";
+  }
+  return result + " at " + std::to_string(parser.mTokenIndex);
+}
+
+// Precedence climbing (the silent parser) against the rule by rule descent the tracing parser keeps
+// Half of the inputs are well formed expressions, the other half random runs of expression tokens,
+// which have to fail (or stop early) at exactly the same token
+static bool TestClimbExpression(Random& random)
+{
+  static const char* const cTokens[] =
+  {
+    "a", "b", "1", "2.0f", "true", "null", "'c'", "\"s\"", "+", "-", "*", "/", "%", "=", "+=", "-=", "||", "&&", "<", ">=",
+    "==", "!=", "!", "&", "++", "--", "(", ")", ".", "->", "[", "]", ",", "as Integer", "as Integer*",
+  };
+  ProgramGenerator generator(random);
+  for (size_t trial = 0; trial < 20000; ++trial)
+  {
+    std::string text;
+    if (trial % 2 == 0)
+      text = generator.Expression(1 + random() % 4);
+    else
+    {
+      for (size_t i = 1 + random() % 14; i > 0; --i)
+        text += std::string(cTokens[random() % (sizeof(cTokens) / sizeof(*cTokens))]) + " ";
+    }
+
+    std::vector<Token> tokens;
+    LanguageScanner::GetInstance().TokenizeSkippingTrivia(text.c_str(), tokens);
+    std::string expected = ParseExpressionToString<TracingParserPolicy>(tokens);
+    std::string actual = ParseExpressionToString<SilentParserPolicy>(tokens);
+    if (expected != actual)
+    {
+      printf("  trial %zu parsed differently: \"%s\"\n", trial, text.c_str());
+      return false;
+    }
+  }
+  return true;
+}
+
+// Parses random programs, flattens them and builds them back: the rebuilt tree must print exactly like the parsed one
+// and flatten to exactly the same arrays (so every token is the same token of the buffer)
+static bool TestFlatAstRoundTrip(Random& random)
+{
+  ProgramGenerator generator(random);
+  size_t parsed = 0;
+  for (size_t trial = 0; trial < 2000; ++trial)
+  {
+    std::string text = generator.Program();
+    TokenBuffer tokens(text.c_str());
+    TokenizeStream(GetStaticLanguageTable(), text.c_str(), tokens, true);
+
+    std::unique_ptr<BlockNode> tree;
+    try
+    {
+      tree = ParseBlock(tokens);
+    }
+    catch (ParsingException& exception)
+    {
+      printf("  trial %zu didn't parse (%s): \"%s\"\n", trial, exception.mError.c_str(), text.c_str());
+      return false;
+    }
+    ++parsed;
+
+    FlatAst flat;
+    flat.Flatten(tree.get(), tokens);
+    std::unique_ptr<AbstractNode> rebuilt = flat.Unflatten();
+    FlatAst reflattened;
+    reflattened.Flatten(rebuilt.get(), tokens);
+    if (PrintTreeToString(tree.get()) != PrintTreeToString(rebuilt.get()) || !SameFlatAst(flat, reflattened))
+    {
+      printf("  trial %zu changed in the round trip: \"%s\"\n", trial, text.c_str());
+      return false;
+    }
+  }
+  return parsed != 0;
+}
+
+static bool WriteFile(const char* path, const std::string& text, const char* mode)
+{
+  FILE* file = fopen(path, mode);
+  if (file == nullptr)
+    return false;
+  bool written = fwrite(text.data(), 1, text.size(), file) == text.size();
+  return fclose(file) == 0 && written;
+}
+
+// SourceFile (mapped when it can be) against the text it was written from, at sizes around page boundaries, and a
+// program parsed from the file against the same program parsed from memory. The text must stay terminated when the
+// file grows while it is open
+static bool TestSourceFile(Random& random)
+{
+  static const char* const cPath = "EquivalenceTests.tmp";
+  static const size_t cSizes[] = { 0, 1, 4095, 4096, 4097, 3 * 4096 + 17, 65535, 65536, 65537 };
+  ProgramGenerator generator(random);
+  bool passed = true;
+  for (size_t trial = 0; passed && trial < 200; ++trial)
+  {
+    size_t size = trial < sizeof(cSizes) / sizeof(cSizes[0]) ? cSizes[trial] : random() % (96 * 1024);
+    std::string text;
+    while (text.size() < size)
+      text += generator.Program();
+    text.resize(size);
+    if (!WriteFile(cPath, text, "wb"))
+    {
+      printf("  unable to write '%s'\n", cPath);
+      return false;
+    }
+
+    std::shared_ptr<const SourceFile> file = SourceFile::Load(cPath);
+    if (file == nullptr || file->GetLength() != size || memcmp(file->GetText(), text.c_str(), size + 1) != 0)
+    {
+      printf("  trial %zu read back a different %zu byte file\n", trial, size);
+      passed = false;
+    }
+    // Appending may be refused while the file is mapped, which is just as good
+    else if (WriteFile(cPath, "grown", "ab") && file->GetText()[size] != '\0')
+    {
+      printf("  trial %zu lost its terminator when the %zu byte file grew\n", trial, size);
+      passed = false;
+    }
+  }
+
+  // A program parsed from the file keeps the file alive and matches the program parsed from memory
+  std::string program = generator.Program();
+  TokenBuffer tokens(program.c_str());
+  TokenizeStream(GetStaticLanguageTable(), program.c_str(), tokens, true);
+  if (passed && WriteFile(cPath, program, "wb"))
+  {
+    std::unique_ptr<BlockNode> tree = ParseBlock(SourceFile::Load(cPath));
+    if (tree->mSource == nullptr || PrintTreeToString(tree.get()) != PrintTreeToString(ParseBlock(tokens).get()))
+    {
+      printf("  the parsed file differs: \"%s\"\n", program.c_str());
+      passed = false;
+    }
+  }
+  remove(cPath);
+
+  // A file that can't be opened is reported like any other parse error
+  try
+  {
+    ParseBlock(SourceFile::Load(cPath));
+    printf("  a missing file parsed\n");
+    passed = false;
+  }
+  catch (ParsingException&)
+  {
+  }
+  return passed;
+}
+
+#if DIRECT_CODED_SCANNER
+// The generated scanner against the table it was generated from, reading from every offset of short random streams,
+// so tokens also start inside comments, strings, numbers and keywords
+static bool TestDirectCodedScanner(Random& random)
+{
+  static const char* const cPieces[] =
+  {
+    " ", "\n", "\t", "abc", "_x9", "class", "classy", "while", "if", "else", "0", "15", "0.5", "1.5e+3f", "2e", ".",
+    "->", "/* c */", "/*", "*/", "// l\n", "\"s\\\"t\"", "\"", "'c'", "'\\n'", "'", "==", "=", "<=", "<<", "+=", "++",
+    "&&", "||", "!", "@", "#", "\x80", "\xff",
+  };
+  const DfaTable& table = GetStaticLanguageTable();
+  for (size_t trial = 0; trial < 300000; ++trial)
+  {
+    std::string text = GenerateText(random, cPieces, random() % 48);
+    // The terminator too
+    for (size_t offset = 0; offset <= text.size(); ++offset)
+    {
+      Token expected;
+      Token actual;
+      ReadTableToken(table, text.c_str() + offset, expected);
+      ReadDirectCodedToken(text.c_str() + offset, actual);
+      if (expected.mText != actual.mText || expected.mLength != actual.mLength || expected.mTokenType != actual.mTokenType)
+      {
+        printf("  \"%s\" at %zu: %d bytes of type %d instead of %d of type %d\n", text.c_str(), offset,
+          (int)actual.mLength, actual.mTokenType, (int)expected.mLength, expected.mTokenType);
+        return false;
+      }
+    }
+  }
+  return true;
+}
+#endif
+
+// Line endings are dropped, since they depend on how the file was written or checked out
+static bool ReadFileText(const char* path, std::string& text)
+{
+  FILE* file = fopen(path, "rb");
+  if (file == nullptr)
+    return false;
+  char buffer[64 * 1024];
+  size_t read = 0;
+  while ((read = fread(buffer, 1, sizeof(buffer), file)) != 0)
+    text.append(buffer, read);
+  fclose(file);
+  text.erase(std::remove(text.begin(), text.end(), '\r'), text.end());
+  return true;
+}
+
+// The checked-in GeneratedScanner.inl against what WriteLanguageScanner generates from the language rules now, so a
+// change to the rules can't leave the direct-coded scanner behind
+static bool TestGeneratedScannerIsCurrent(Random&)
+{
+  static const char* const cGeneratedPath = "EquivalenceTests.inl";
+  std::string expected;
+  bool generated = WriteLanguageScanner(cGeneratedPath) && ReadFileText(cGeneratedPath, expected);
+  remove(cGeneratedPath);
+  if (!generated)
+  {
+    printf("  unable to generate '%s'\n", cGeneratedPath);
+    return false;
+  }
+
+  // Next to this file, or under the assignment directory (where the drivers run)
+  std::string path = __FILE__;
+  path = path.substr(0, path.find_last_of("/\\") + 1) + "GeneratedScanner.inl";
+  std::string actual;
+  if (!ReadFileText(path.c_str(), actual) && !ReadFileText("UserCode/GeneratedScanner.inl", actual))
+  {
+    printf("  unable to find GeneratedScanner.inl\n");
+    return false;
+  }
+  if (expected != actual)
+  {
+    printf("  GeneratedScanner.inl is out of date (regenerate it with the ScannerGenerator configuration)\n");
+    return false;
+  }
+  return true;
+}
+
+// Tokenizes the whole stream with the table, the same way TokenizeStream does
+static std::vector<Token> ReadAllTableTokens(const DfaTable& table, const char* stream)
+{
+  std::vector<Token> tokens;
+  while (*stream != '\0')
+  {
+    Token token;
+    ReadTableToken(table, stream, token);
+    tokens.push_back(token);
+    stream += token.mLength != 0 ? token.mLength : 1;
+  }
+  return tokens;
+}
+
+// DfaLoop::Skip (the vector kernels) against the same table with its loops cleared, so every byte takes a transition
+// Long runs of whitespace, identifier bodies, comments and strings start at every alignment 0-31 of a 32 byte aligned
+// buffer. The bytes after the terminator carry on the run, so a kernel that reads past the terminator can't miss it
+static bool TestDfaLoopSkip(Random& random)
+{
+  struct Run
+  {
+    const char* mStart;
+    const char* mBody;
+  };
+  static const Run cRuns[] =
+  {
+    { "", " \t\r\n" },
+    { "a", "abcxyzABCXYZ_0189" },
+    { "//", "comment body \t*/!@#\x80\xff" },
+    { "/*", "comment body \n\t*/!@#\x80\xff" },
+    { "\"", "string body \t\\\"'\x80" },
+  };
+  static const char* const cEnds[] = { "", " ", "x", "\n", "*/", "\"", "+", "\x80", "/*" };
+
+  const DfaTable& table = GetStaticLanguageTable();
+  std::vector<DfaLoop> noLoops(table.mStateCount);
+  const DfaTable scalar(table.mStateCount, table.mClassCount, table.mByteClasses, table.mTransitions,
+    table.mAcceptingTokens, noLoops.data());
+
+  const size_t cMaxBody = 300;
+  std::vector<char> storage(1024 + 32);
+  char* aligned = storage.data() + (32 - (size_t)storage.data() % 32) % 32;
+  for (size_t trial = 0; trial < 5000; ++trial)
+  {
+    const Run& run = cRuns[random() % (sizeof(cRuns) / sizeof(cRuns[0]))];
+    size_t bodySize = strlen(run.mBody);
+    std::string text = run.mStart;
+    for (size_t length = random() % cMaxBody; length != 0; --length)
+      text += run.mBody[random() % bodySize];
+    text += cEnds[random() % (sizeof(cEnds) / sizeof(cEnds[0]))];
+
+    for (size_t alignment = 0; alignment < 32; ++alignment)
+    {
+      char* stream = aligned + alignment;
+      memcpy(stream, text.c_str(), text.size() + 1);
+      memset(stream + text.size() + 1, run.mBody[0], 64);
+
+      std::vector<Token> expected = ReadAllTableTokens(scalar, stream);
+      std::vector<Token> actual = ReadAllTableTokens(table, stream);
+      if (!SameTokens(expected, actual))
+      {
+        printf("  \"%s\" at alignment %zu: %zu tokens instead of %zu\n", text.c_str(), alignment, actual.size(),
+          expected.size());
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// TokenizeStreamLinear against TokenizeStream on the inputs maximal munch is quadratic on: a piece that starts a long
+// token that never completes ("1.5e" "1.5e" ..., or an unterminated "/*" after every '/'), repeated, mixed with other
+// pieces now and then so the remembered (state, position) pairs are reused across different tokens
+static bool TestTokenizeLinear(Random& random)
+{
+  static const char* const cPathological[] =
+  {
+    "1.5e", "1.", "1.5e+", "/*a", "/*", "a/*", "\"a", "\"\\", "'", "'\\", "//", "->", "0x",
+  };
+  static const char* const cPieces[] =
+  {
+    " ", "\n", "a", "1", ".", "e", "+", "*/", "\"", "*", "/", "'c'", "\"s\"", "/**/", "// l\n",
+  };
+  const DfaTable& table = GetStaticLanguageTable();
+  for (size_t trial = 0; trial < 2000; ++trial)
+  {
+    const char* piece = cPathological[random() % (sizeof(cPathological) / sizeof(cPathological[0]))];
+    std::string text;
+    for (size_t count = random() % 400; count != 0; --count)
+    {
+      text += piece;
+      if (random() % 8 == 0)
+        text += cPieces[random() % (sizeof(cPieces) / sizeof(cPieces[0]))];
+    }
+
+    std::vector<Token> expected;
+    std::vector<Token> actual;
+    TokenizeStream(table, text.c_str(), expected);
+    TokenizeStreamLinear(table, text.c_str(), actual);
+    if (!SameTokens(expected, actual))
+    {
+      printf("  trial %zu (\"%s\" repeated): %zu tokens instead of %zu\n", trial, piece, actual.size(), expected.size());
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool IsIdentifierCharacter(char value)
+{
+  return (value >= 'a' && value <= 'z') || (value >= 'A' && value <= 'Z') || (value >= '0' && value <= '9') || value == '_';
+}
+
+// The keyword branches of the automaton against the old way of finding keywords: read an identifier, then look its
+// text up in a map loaded from TokenKeywords.inl. Streams are made of keywords, keywords with a character added or
+// removed, and the separators between them, and both the static and the runtime compiled tables are checked
+static bool TestKeywordTrie(Random& random)
+{
+  std::unordered_map<std::string, int> lookupMap;
+  std::vector<std::string> keywords;
+#define TOKEN(Name, Value) lookupMap.insert(std::make_pair(Value, TokenType::Name)); keywords.push_back(Value);
+#include "../Drivers/TokenKeywords.inl"
+#undef TOKEN
+  static const char* const cSeparators[] = { " ", "\n", "(", ".", "->", "+", "1", "/* c */", "\"s\"" };
+  static const char* const cSuffixes = "aeiz_09AZ";
+
+  DfaState* root = BuildLanguageDfa();
+  const DfaTable* tables[] = { &GetStaticLanguageTable(), root->mTable };
+  bool passed = true;
+  for (size_t trial = 0; passed && trial < 20000; ++trial)
+  {
+    std::string text;
+    for (size_t count = 1 + random() % 8; count != 0; --count)
+    {
+      std::string word = keywords[random() % keywords.size()];
+      switch (random() % 5)
+      {
+      case 0:
+        word += cSuffixes[random() % strlen(cSuffixes)];
+        break;
+      case 1:
+        word.pop_back();
+        break;
+      case 2:
+        word[0] = (char)(word[0] - 'a' + 'A');
+        break;
+      }
+      text += word;
+      text += cSeparators[random() % (sizeof(cSeparators) / sizeof(cSeparators[0]))];
+    }
+
+    for (size_t i = 0; passed && i < sizeof(tables) / sizeof(tables[0]); ++i)
+    {
+      const DfaTable* table = tables[i];
+      std::vector<Token> tokens;
+      TokenizeStream(*table, text.c_str(), tokens);
+      for (const Token& token : tokens)
+      {
+        // Anything that starts like an identifier runs to the end of the identifier, and is a keyword exactly when
+        // the map has its text
+        bool identifier = IsIdentifierCharacter(token.mText[0]) && !(token.mText[0] >= '0' && token.mText[0] <= '9');
+        size_t length = 0;
+        while (identifier && IsIdentifierCharacter(token.mText[length]))
+          ++length;
+        auto it = lookupMap.find(std::string(token.mText, token.mLength));
+        int type = !identifier ? token.mTokenType : it != lookupMap.end() ? it->second : (int)TokenType::Identifier;
+        bool keyword = token.mTokenType > TokenType::KeywordStart;
+        if ((identifier && token.mLength != length) || token.mTokenType != type || (!identifier && keyword))
+        {
+          printf("  \"%s\": \"%.*s\" read as type %d\n", text.c_str(), (int)token.mLength, token.mText, token.mTokenType);
+          passed = false;
+          break;
+        }
+      }
+    }
+  }
+  DeleteStateAndChildren(root);
+  return passed;
+}
+
+// Random digits, with leading zeros now and then
+static std::string GenerateDigits(Random& random, size_t maxCount)
+{
+  std::string digits;
+  for (size_t count = 1 + random() % maxCount; count != 0; --count)
+    digits += (char)('0' + random() % 10);
+  return digits;
+}
+
+// DecodeIntegerLiteral and DecodeFloatLiteral against the atoi and (float)atof the pre-pass used to call, on every
+// shape the scanner accepts (including values too large for an int, a float or a double), both called directly
+// and through the values the language scanner stores on the token
+static bool TestDecodeLiterals(Random& random)
+{
+  std::vector<std::string> integers =
+  {
+    "0", "7", "000123", "2147483647", "2147483648", "4294967295", "4294967296", "9223372036854775807",
+    "9223372036854775808", "18446744073709551616", "99999999999999999999999999999999",
+  };
+  std::vector<std::string> floats =
+  {
+    "0.0", "0.0f", "1.5f", "0.1", "3.4028234e38", "3.4028236e38", "1.0e39f", "1.0e308", "1.0e309", "1.0e400",
+    "1.17549435e-38", "1.4e-45", "1.0e-46", "4.9e-324", "1.0e-400", "2.5e+3f", "123456789.123456789e-5",
+  };
+  for (size_t trial = 0; trial < 100000; ++trial)
+  {
+    integers.push_back(GenerateDigits(random, 24));
+    std::string text = GenerateDigits(random, 12) + "." + GenerateDigits(random, 12);
+    if (random() % 2 == 0)
+      text += (random() % 3 == 0 ? "e-" : random() % 2 == 0 ? "e+" : "e") + GenerateDigits(random, 3);
+    if (random() % 2 == 0)
+      text += "f";
+    floats.push_back(text);
+  }
+
+  for (const std::string& text : integers)
+  {
+    Token token(text.c_str(), text.size(), TokenType::IntegerLiteral);
+    Token scanned = token;
+    AnnotateLanguageToken(scanned);
+    int expected = atoi(text.c_str());
+    if (DecodeIntegerLiteral(token) != expected || GetIntegerLiteralValue(scanned) != expected)
+    {
+      printf("  \"%s\" decoded as %d and %d instead of %d\n", text.c_str(), DecodeIntegerLiteral(token),
+        GetIntegerLiteralValue(scanned), expected);
+      return false;
+    }
+  }
+
+  for (const std::string& text : floats)
+  {
+    Token token(text.c_str(), text.size(), TokenType::FloatLiteral);
+    Token scanned = token;
+    AnnotateLanguageToken(scanned);
+    // Compared bit for bit, so a different rounding or a lost denormal shows up
+    float expected = (float)atof(text.c_str());
+    float decoded = DecodeFloatLiteral(token);
+    float stored = GetFloatLiteralValue(scanned);
+    if (memcmp(&decoded, &expected, sizeof(float)) != 0 || memcmp(&stored, &expected, sizeof(float)) != 0)
+    {
+      printf("  \"%s\" decoded as %.9g and %.9g instead of %.9g\n", text.c_str(), decoded, stored, expected);
+      return false;
+    }
+  }
+  return true;
+}
+
+// Collects the literals of a tree
+class LiteralCollector : public Visitor
+{
+public:
+  VisitResult Visit(LiteralNode* node) override
+  {
+    mLiterals.push_back(node);
+    return VisitResult::Continue;
+  }
+
+  std::vector<LiteralNode*> mLiterals;
+};
+
+// The escapes of character and string literals. \n, \r and \t stand for their control characters and any other
+// escaped character for itself, so \" and \' are quotes and \\ a backslash (the old decoder turned \" into a single
+// quote and \' into a null). The scanner only lets \" through in strings, so a program with one is also run through
+// InterpreterPrePass, which must pool the decoded strings on the tree
+static bool TestEscapeDecoding(Random& random)
+{
+  struct Escape
+  {
+    const char* mSource;
+    char mValue;
+  };
+  static const Escape cEscapes[] =
+  {
+    { "\\n", '\n' }, { "\\r", '\r' }, { "\\t", '\t' }, { "\\\"", '"' }, { "\\'", '\'' }, { "\\\\", '\\' },
+    { "a", 'a' }, { " ", ' ' }, { "'", '\'' }, { "\\a", 'a' },
+  };
+  const size_t escapeCount = sizeof(cEscapes) / sizeof(cEscapes[0]);
+
+  for (const Escape& escape : cEscapes)
+  {
+    std::string text = std::string("'") + escape.mSource + "'";
+    Token token(text.c_str(), text.size(), TokenType::CharacterLiteral);
+    Token scanned = token;
+    AnnotateLanguageToken(scanned);
+    if (DecodeCharacterLiteral(token) != escape.mValue || GetCharacterLiteralValue(scanned) != escape.mValue)
+    {
+      printf("  %s decoded as %d instead of %d\n", text.c_str(), DecodeCharacterLiteral(token), escape.mValue);
+      return false;
+    }
+  }
+
+  ConstantPool pool;
+  for (size_t trial = 0; trial < 20000; ++trial)
+  {
+    std::string text = "\"";
+    std::string expected;
+    for (size_t count = random() % 12; count != 0; --count)
+    {
+      const Escape& escape = cEscapes[random() % escapeCount];
+      text += escape.mSource;
+      expected += escape.mValue;
+    }
+    text += "\"";
+
+    Token token(text.c_str(), text.size(), TokenType::StringLiteral);
+    std::string_view value = pool.AddLiteral(token);
+    if (value != expected || value.data()[value.size()] != '\0' || pool.Add(expected.c_str(), expected.size()).data() != value.data())
+    {
+      printf("  %s decoded as \"%.*s\"\n", text.c_str(), (int)value.size(), value.data());
+      return false;
+    }
+  }
+
+  // Two compilations of the same program each get their own pool, which the literal values point into
+  static const char* const cProgram =
+    "function Main() : Integer { var s : Byte* = \"say \\\"hi\\\"\\n\"; var c : Byte = '\\t'; return 0; }";
+  std::vector<Token> tokens;
+  TokenizeStreamSkippingTrivia(GetStaticLanguageTable(), cProgram, tokens);
+  AnnotateLanguageTokens(tokens);
+  std::unique_ptr<BlockNode> trees[2];
+  std::unique_ptr<Library> libraries[2];
+  for (size_t i = 0; i < 2; ++i)
+  {
+    trees[i] = ParseBlock(tokens);
+    libraries[i] = std::make_unique<Library>();
+    InitializeCoreLibrary4(libraries[i].get());
+    SemanticAnalyize(trees[i].get(), libraries[i].get());
+    InterpreterPrePass(trees[i].get());
+
+    LiteralCollector collector;
+    trees[i]->Walk(&collector);
+    if (trees[i]->mConstants == nullptr || collector.mLiterals.size() != 3 ||
+      strcmp((const char*)collector.mLiterals[0]->mValue.mValue.mPointer, "say \"hi\"\n") != 0 ||
+      collector.mLiterals[1]->mValue.mValue.mByte != '\t')
+    {
+      printf("  the literals of tree %zu weren't decoded into its pool\n", i);
+      return false;
+    }
+  }
+  if (trees[0]->mConstants == trees[1]->mConstants)
+  {
+    printf("  both trees share a pool\n");
+    return false;
+  }
+  return true;
+}
+
+// The seed (1 by default) can be given as the only argument to reproduce a failure
+int main(int argc, char* argv[])
+{
+  unsigned long seed = argc > 1 ? strtoul(argv[1], nullptr, 10) : 1;
+  // Nothing is traced, the trees are only printed into strings
+  NullDiagnosticSink nullSink;
+  SetDiagnosticSink(&nullSink);
+
+  struct Test
+  {
+    const char* mName;
+    bool (*mRun)(Random& random);
+  };
+  const Test tests[] =
+  {
+    { "parallel tokenize", TestParallelTokenize },
+    { "retokenize edit", TestRetokenizeEdit },
+    { "climb expression", TestClimbExpression },
+    { "flat AST round trip", TestFlatAstRoundTrip },
+    { "source file", TestSourceFile },
+#if DIRECT_CODED_SCANNER
+    { "direct coded scanner", TestDirectCodedScanner },
+#endif
+    { "generated scanner", TestGeneratedScannerIsCurrent },
+    { "DFA loop skip", TestDfaLoopSkip },
+    { "linear tokenize", TestTokenizeLinear },
+    { "keyword trie", TestKeywordTrie },
+    { "decode literals", TestDecodeLiterals },
+    { "escape decoding", TestEscapeDecoding },
+  };
+
+  bool succeeded = true;
+  for (const Test& test : tests)
+  {
+    // Each test gets its own generator so adding a test never changes the inputs of another
+    Random random((Random::result_type)seed);
+    bool passed = test.mRun(random);
+    printf("%-24s %s\n", test.mName, passed ? "passed" : "FAILED");
+    succeeded = passed && succeeded;
+  }
+  printf("seed %lu\n", seed);
+  return succeeded ? 0 : 1;
+}
+
+#endif
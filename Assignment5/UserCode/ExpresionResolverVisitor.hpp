@@ -3,14 +3,16 @@
 #include "Visitor.hpp"
 #include "../Drivers/Driver4.hpp"
 #include "LibraryHelpers.hpp"
+#include "SymbolIndex.hpp"
 #include "SymbolStack.hpp"
 
 class ExpresionResolverVisitor : public Visitor
 {
 public:
-  ExpresionResolverVisitor(Library* library)
+  ExpresionResolverVisitor(Library* library, SymbolIndex* symbolIndex)
   {
     mLibrary = library;
+    mSymbolIndex = symbolIndex;
   }
 
   virtual VisitResult Visit(BlockNode* node) override
@@ -54,8 +56,6 @@ public:
 
   virtual VisitResult Visit(ParameterNode* node) override
   {
-    const std::string& varName = node->mName.str();
-    //Variable* varSymbol = mLibrary->CreateVariable(varName, false);
     mSymbolStack.Add(node->mSymbol);
     TryWalk(node->mInitialValue);
     return VisitResult::Stop;
@@ -63,9 +63,6 @@ public:
 
   virtual VisitResult Visit(VariableNode* node) override
   {
-    const std::string& varName = node->mName.str();
-    //Variable* varSymbol = mLibrary->CreateVariable(varName, false);
-
     mSymbolStack.Add(node->mSymbol);
     TryWalk(node->mInitialValue);
     return VisitResult::Stop;
@@ -98,10 +95,9 @@ public:
 
   virtual VisitResult Visit(NameReferenceNode* node) override
   {
-    const std::string& name = node->mName.str();
-    node->mSymbol = mSymbolStack.Find(name);
+    node->mSymbol = mSymbolStack.Find(node->mName);
     if(node->mSymbol == nullptr)
-      ErrorSymbolNotFound(name);
+      ErrorSymbolNotFound(node->mName.str());
     node->mResolvedType = node->mSymbol->mType;
     return VisitResult::Stop;
   }
@@ -122,7 +118,6 @@ public:
   {
     TryWalk(node->mLeft);
 
-    const std::string& name = node->mName.str();
     Type* leftType = node->mLeft->mResolvedType;
     Type* derefType = leftType;
     //std::unordered_map<std::string, Symbol*>* membersByName = nullptr;
@@ -137,11 +132,10 @@ public:
         ErrorInvalidMemberAccess(node);
       derefType = leftType->mPointerToType;
     }
-    auto&& it = derefType->mMembersByName.find(name);
-    if (it == derefType->mMembersByName.end())
+    node->mResolvedMember = mSymbolIndex->FindMember(derefType, node->mName);
+    if (node->mResolvedMember == nullptr)
       ErrorInvalidMemberAccess(node);
 
-    node->mResolvedMember = it->second;
     node->mResolvedType = node->mResolvedMember->mType;
     return VisitResult::Stop;
   }
@@ -447,6 +441,7 @@ public:
 
 
   Library* mLibrary = nullptr;
+  SymbolIndex* mSymbolIndex = nullptr;
   BlockNode* mBlock = nullptr;
   ClassNode* mClass = nullptr;
   FunctionNode* mFunction = nullptr;
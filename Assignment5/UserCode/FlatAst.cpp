@@ -0,0 +1,580 @@
+/******************************************************************\
+ * Author:
+ * Copyright 2015, DigiPen Institute of Technology
+\******************************************************************/
+#include "FlatAst.hpp"
+
+#include <algorithm>
+#include "LanguageScanner.hpp"
+#include "Visitor.hpp"
+
+// Indexed by kind (see the layout in FlatAst.hpp)
+static const uint8_t cFixedChildCounts[FlatNodeKind::EnumCount] =
+{
+  0, // Block
+  0, // Class
+  2, // Variable
+  2, // Parameter
+  0, // Scope
+  2, // Function
+  1, // PointerType
+  1, // ReferenceType
+  0, // NamedType
+  1, // FunctionType
+  0, // Label
+  0, // Goto
+  1, // Return
+  0, // Break
+  0, // Continue
+  3, // If
+  2, // While
+  5, // For
+  0, // Literal
+  0, // NameReference
+  2, // BinaryOperator
+  1, // UnaryOperator
+  1, // MemberAccess
+  1, // Call
+  2, // Cast
+  2, // Index
+};
+
+static const uint8_t cTokenCounts[FlatNodeKind::EnumCount] =
+{
+  0, // Block
+  1, // Class
+  1, // Variable
+  1, // Parameter
+  0, // Scope
+  1, // Function
+  0, // PointerType
+  0, // ReferenceType
+  1, // NamedType
+  0, // FunctionType
+  1, // Label
+  1, // Goto
+  0, // Return
+  0, // Break
+  0, // Continue
+  0, // If
+  0, // While
+  0, // For
+  1, // Literal
+  1, // NameReference
+  1, // BinaryOperator
+  1, // UnaryOperator
+  2, // MemberAccess
+  0, // Call
+  0, // Cast
+  0, // Index
+};
+
+// Appends each node it visits (and then its children, in the order Walk would visit them) to a FlatAst
+// Every visit walks the children itself and returns Stop, so that null children still get their slot
+class FlattenVisitor : public Visitor
+{
+public:
+  explicit FlattenVisitor(FlatAst& ast) :
+    mAst(ast)
+  {
+  }
+
+  FlatNodeId Add(AbstractNode* node)
+  {
+    if (node == nullptr)
+      return cNullFlatNode;
+
+    FlatNodeId id = (FlatNodeId)mAst.GetNodeCount();
+    node->Walk(this);
+    // Only the concrete node types can be flattened
+    ErrorIf(mAst.GetNodeCount() == id, "The node type can't be flattened");
+    return id;
+  }
+
+  template <typename NodeType>
+  FlatNodeId Add(const std::unique_ptr<NodeType>& node)
+  {
+    return Add(node.get());
+  }
+
+  virtual VisitResult Visit(BlockNode* node)
+  {
+    FlatNodeId id = Begin(FlatNodeKind::Block, node->mGlobals.size());
+    AddList(id, node->mGlobals);
+    return End(id);
+  }
+
+  virtual VisitResult Visit(ClassNode* node)
+  {
+    FlatNodeId id = Begin(FlatNodeKind::Class, node->mMembers.size(), &node->mName);
+    AddList(id, node->mMembers);
+    return End(id);
+  }
+
+  virtual VisitResult Visit(VariableNode* node)
+  {
+    return AddVariable(FlatNodeKind::Variable, node);
+  }
+
+  virtual VisitResult Visit(ParameterNode* node)
+  {
+    return AddVariable(FlatNodeKind::Parameter, node);
+  }
+
+  virtual VisitResult Visit(ScopeNode* node)
+  {
+    FlatNodeId id = Begin(FlatNodeKind::Scope, node->mStatements.size());
+    AddList(id, node->mStatements);
+    return End(id);
+  }
+
+  virtual VisitResult Visit(FunctionNode* node)
+  {
+    FlatNodeId id = Begin(FlatNodeKind::Function, node->mParameters.size(), &node->mName);
+    AddList(id, node->mParameters);
+    SetChild(id, 0, Add(node->mReturnType));
+    SetChild(id, 1, Add(node->mScope));
+    return End(id);
+  }
+
+  virtual VisitResult Visit(PointerTypeNode* node)
+  {
+    FlatNodeId id = Begin(FlatNodeKind::PointerType);
+    SetChild(id, 0, Add(node->mPointerTo));
+    return End(id);
+  }
+
+  virtual VisitResult Visit(ReferenceTypeNode* node)
+  {
+    FlatNodeId id = Begin(FlatNodeKind::ReferenceType);
+    SetChild(id, 0, Add(node->mReferenceTo));
+    return End(id);
+  }
+
+  virtual VisitResult Visit(NamedTypeNode* node)
+  {
+    return End(Begin(FlatNodeKind::NamedType, 0, &node->mName));
+  }
+
+  virtual VisitResult Visit(FunctionTypeNode* node)
+  {
+    FlatNodeId id = Begin(FlatNodeKind::FunctionType, node->mParameters.size());
+    AddList(id, node->mParameters);
+    SetChild(id, 0, Add(node->mReturn));
+    return End(id);
+  }
+
+  virtual VisitResult Visit(LabelNode* node)
+  {
+    return End(Begin(FlatNodeKind::Label, 0, &node->mName));
+  }
+
+  virtual VisitResult Visit(GotoNode* node)
+  {
+    return End(Begin(FlatNodeKind::Goto, 0, &node->mName));
+  }
+
+  virtual VisitResult Visit(ReturnNode* node)
+  {
+    FlatNodeId id = Begin(FlatNodeKind::Return);
+    SetChild(id, 0, Add(node->mReturnValue));
+    return End(id);
+  }
+
+  virtual VisitResult Visit(BreakNode*)
+  {
+    return End(Begin(FlatNodeKind::Break));
+  }
+
+  virtual VisitResult Visit(ContinueNode*)
+  {
+    return End(Begin(FlatNodeKind::Continue));
+  }
+
+  virtual VisitResult Visit(IfNode* node)
+  {
+    FlatNodeId id = Begin(FlatNodeKind::If);
+    SetChild(id, 0, Add(node->mCondition));
+    SetChild(id, 1, Add(node->mScope));
+    SetChild(id, 2, Add(node->mElse));
+    return End(id);
+  }
+
+  virtual VisitResult Visit(WhileNode* node)
+  {
+    FlatNodeId id = Begin(FlatNodeKind::While);
+    SetChild(id, 0, Add(node->mCondition));
+    SetChild(id, 1, Add(node->mScope));
+    return End(id);
+  }
+
+  virtual VisitResult Visit(ForNode* node)
+  {
+    // Walk visits the scope before the iterator
+    FlatNodeId id = Begin(FlatNodeKind::For);
+    SetChild(id, 0, Add(node->mInitialVariable));
+    SetChild(id, 1, Add(node->mInitialExpression));
+    SetChild(id, 2, Add(node->mCondition));
+    SetChild(id, 4, Add(node->mScope));
+    SetChild(id, 3, Add(node->mIterator));
+    return End(id);
+  }
+
+  virtual VisitResult Visit(LiteralNode* node)
+  {
+    return End(Begin(FlatNodeKind::Literal, 0, &node->mToken));
+  }
+
+  virtual VisitResult Visit(NameReferenceNode* node)
+  {
+    return End(Begin(FlatNodeKind::NameReference, 0, &node->mName));
+  }
+
+  virtual VisitResult Visit(BinaryOperatorNode* node)
+  {
+    FlatNodeId id = Begin(FlatNodeKind::BinaryOperator, 0, &node->mOperator);
+    SetChild(id, 0, Add(node->mLeft));
+    SetChild(id, 1, Add(node->mRight));
+    return End(id);
+  }
+
+  virtual VisitResult Visit(UnaryOperatorNode* node)
+  {
+    FlatNodeId id = Begin(FlatNodeKind::UnaryOperator, 0, &node->mOperator);
+    SetChild(id, 0, Add(node->mRight));
+    return End(id);
+  }
+
+  virtual VisitResult Visit(MemberAccessNode* node)
+  {
+    FlatNodeId id = Begin(FlatNodeKind::MemberAccess, 0, &node->mOperator, &node->mName);
+    SetChild(id, 0, Add(node->mLeft));
+    return End(id);
+  }
+
+  virtual VisitResult Visit(CallNode* node)
+  {
+    FlatNodeId id = Begin(FlatNodeKind::Call, node->mArguments.size());
+    SetChild(id, 0, Add(node->mLeft));
+    AddList(id, node->mArguments);
+    return End(id);
+  }
+
+  virtual VisitResult Visit(CastNode* node)
+  {
+    FlatNodeId id = Begin(FlatNodeKind::Cast);
+    SetChild(id, 0, Add(node->mLeft));
+    SetChild(id, 1, Add(node->mType));
+    return End(id);
+  }
+
+  virtual VisitResult Visit(IndexNode* node)
+  {
+    FlatNodeId id = Begin(FlatNodeKind::Index);
+    SetChild(id, 0, Add(node->mLeft));
+    SetChild(id, 1, Add(node->mIndex));
+    return End(id);
+  }
+
+private:
+  // Appends the node itself with all of its slots empty (its children come after it)
+  FlatNodeId Begin(FlatNodeKind::Enum kind, size_t listCount = 0, const Token* token0 = nullptr, const Token* token1 = nullptr)
+  {
+    FlatNodeId id = (FlatNodeId)mAst.mKinds.size();
+    mAst.mKinds.push_back((uint8_t)kind);
+    mAst.mSubtreeEnds.push_back(cNullFlatNode);
+
+    mAst.mFirstTokens.push_back((uint32_t)mAst.mTokens.size());
+    if (token0 != nullptr)
+      mAst.mTokens.push_back(FindToken(*token0));
+    if (token1 != nullptr)
+      mAst.mTokens.push_back(FindToken(*token1));
+
+    mAst.mChildren.resize(mAst.mChildren.size() + FlatAst::GetFixedChildCount(kind) + listCount, cNullFlatNode);
+    mAst.mChildBegins.push_back((uint32_t)mAst.mChildren.size());
+    return id;
+  }
+
+  // The buffer's offsets are in order, so a token is found by where its text starts
+  TokenId FindToken(const Token& token)
+  {
+    const TokenBuffer& tokens = *mAst.mTokenBuffer;
+    size_t offset = (size_t)(token.mText - tokens.mText);
+    auto it = std::lower_bound(tokens.mOffsets.begin(), tokens.mOffsets.end(), offset);
+    ErrorIf(it == tokens.mOffsets.end() || *it != offset, "The tree wasn't parsed from the buffer");
+    return TokenId((uint32_t)(it - tokens.mOffsets.begin()));
+  }
+
+  VisitResult End(FlatNodeId id)
+  {
+    mAst.mSubtreeEnds[id] = (FlatNodeId)mAst.mKinds.size();
+    return VisitResult::Stop;
+  }
+
+  VisitResult AddVariable(FlatNodeKind::Enum kind, VariableNode* node)
+  {
+    FlatNodeId id = Begin(kind, 0, &node->mName);
+    SetChild(id, 0, Add(node->mType));
+    SetChild(id, 1, Add(node->mInitialValue));
+    return End(id);
+  }
+
+  template <typename NodeType>
+  void AddList(FlatNodeId id, unique_vector<NodeType>& nodes)
+  {
+    size_t slot = FlatAst::GetFixedChildCount(mAst.GetKind(id));
+    for (size_t i = 0; i < nodes.size(); ++i)
+      SetChild(id, slot + i, Add(nodes[i].get()));
+  }
+
+  void SetChild(FlatNodeId id, size_t slot, FlatNodeId child)
+  {
+    mAst.mChildren[mAst.mChildBegins[id] + slot] = child;
+  }
+
+  FlatAst& mAst;
+};
+
+FlatAst::FlatAst()
+{
+  Clear();
+}
+
+void FlatAst::Flatten(AbstractNode* root, const TokenBuffer& tokens)
+{
+  Clear();
+  mTokenBuffer = &tokens;
+  FlattenVisitor visitor(*this);
+  visitor.Add(root);
+}
+
+void FlatAst::Clear()
+{
+  mKinds.clear();
+  mFirstTokens.clear();
+  mSubtreeEnds.clear();
+  mChildBegins.assign(1, 0);
+  mChildren.clear();
+  mTokenBuffer = nullptr;
+  mTokens.clear();
+}
+
+std::unique_ptr<AbstractNode> FlatAst::Unflatten(FlatNodeId root) const
+{
+  if (root >= GetNodeCount())
+    return nullptr;
+  return Build(root);
+}
+
+size_t FlatAst::GetFixedChildCount(FlatNodeKind::Enum kind)
+{
+  return cFixedChildCounts[kind];
+}
+
+size_t FlatAst::GetTokenCount(FlatNodeKind::Enum kind)
+{
+  return cTokenCounts[kind];
+}
+
+Token FlatAst::BuildToken(FlatNodeId node, size_t index) const
+{
+  Token token = mTokenBuffer->GetToken(GetToken(node, index));
+  AnnotateLanguageToken(token);
+  return token;
+}
+
+template <typename NodeType>
+std::unique_ptr<NodeType> FlatAst::BuildChild(FlatNodeId node, size_t slot) const
+{
+  // The kind of the child decides its type, so this cast is always to the right type (or a base of it)
+  return std::unique_ptr<NodeType>(static_cast<NodeType*>(Build(GetChild(node, slot)).release()));
+}
+
+template <typename NodeType>
+void FlatAst::BuildList(FlatNodeId node, unique_vector<NodeType>& nodes) const
+{
+  size_t count = GetChildCount(node);
+  for (size_t slot = GetFixedChildCount(GetKind(node)); slot < count; ++slot)
+    nodes.push_back(BuildChild<NodeType>(node, slot));
+}
+
+std::unique_ptr<AbstractNode> FlatAst::Build(FlatNodeId node) const
+{
+  if (node == cNullFlatNode)
+    return nullptr;
+
+  switch (GetKind(node))
+  {
+  case FlatNodeKind::Block:
+  {
+    auto&& result = std::make_unique<BlockNode>();
+    BuildList(node, result->mGlobals);
+    return std::move(result);
+  }
+  case FlatNodeKind::Class:
+  {
+    auto&& result = std::make_unique<ClassNode>();
+    result->mName = BuildToken(node);
+    BuildList(node, result->mMembers);
+    return std::move(result);
+  }
+  case FlatNodeKind::Variable:
+  case FlatNodeKind::Parameter:
+  {
+    std::unique_ptr<VariableNode> result;
+    if (GetKind(node) == FlatNodeKind::Parameter)
+      result = std::make_unique<ParameterNode>();
+    else
+      result = std::make_unique<VariableNode>();
+    result->mName = BuildToken(node);
+    result->mType = BuildChild<TypeNode>(node, 0);
+    result->mInitialValue = BuildChild<ExpressionNode>(node, 1);
+    return result;
+  }
+  case FlatNodeKind::Scope:
+  {
+    auto&& result = std::make_unique<ScopeNode>();
+    BuildList(node, result->mStatements);
+    return std::move(result);
+  }
+  case FlatNodeKind::Function:
+  {
+    auto&& result = std::make_unique<FunctionNode>();
+    result->mName = BuildToken(node);
+    result->mReturnType = BuildChild<TypeNode>(node, 0);
+    result->mScope = BuildChild<ScopeNode>(node, 1);
+    BuildList(node, result->mParameters);
+    return std::move(result);
+  }
+  case FlatNodeKind::PointerType:
+  {
+    auto&& result = std::make_unique<PointerTypeNode>();
+    result->mPointerTo = BuildChild<TypeNode>(node, 0);
+    return std::move(result);
+  }
+  case FlatNodeKind::ReferenceType:
+  {
+    auto&& result = std::make_unique<ReferenceTypeNode>();
+    result->mReferenceTo = BuildChild<TypeNode>(node, 0);
+    return std::move(result);
+  }
+  case FlatNodeKind::NamedType:
+  {
+    auto&& result = std::make_unique<NamedTypeNode>();
+    result->mName = BuildToken(node);
+    return std::move(result);
+  }
+  case FlatNodeKind::FunctionType:
+  {
+    auto&& result = std::make_unique<FunctionTypeNode>();
+    result->mReturn = BuildChild<TypeNode>(node, 0);
+    BuildList(node, result->mParameters);
+    return std::move(result);
+  }
+  case FlatNodeKind::Label:
+  {
+    auto&& result = std::make_unique<LabelNode>();
+    result->mName = BuildToken(node);
+    return std::move(result);
+  }
+  case FlatNodeKind::Goto:
+  {
+    auto&& result = std::make_unique<GotoNode>();
+    result->mName = BuildToken(node);
+    return std::move(result);
+  }
+  case FlatNodeKind::Return:
+  {
+    auto&& result = std::make_unique<ReturnNode>();
+    result->mReturnValue = BuildChild<ExpressionNode>(node, 0);
+    return std::move(result);
+  }
+  case FlatNodeKind::Break:
+    return std::make_unique<BreakNode>();
+  case FlatNodeKind::Continue:
+    return std::make_unique<ContinueNode>();
+  case FlatNodeKind::If:
+  {
+    auto&& result = std::make_unique<IfNode>();
+    result->mCondition = BuildChild<ExpressionNode>(node, 0);
+    result->mScope = BuildChild<ScopeNode>(node, 1);
+    result->mElse = BuildChild<IfNode>(node, 2);
+    return std::move(result);
+  }
+  case FlatNodeKind::While:
+  {
+    auto&& result = std::make_unique<WhileNode>();
+    result->mCondition = BuildChild<ExpressionNode>(node, 0);
+    result->mScope = BuildChild<ScopeNode>(node, 1);
+    return std::move(result);
+  }
+  case FlatNodeKind::For:
+  {
+    auto&& result = std::make_unique<ForNode>();
+    result->mInitialVariable = BuildChild<VariableNode>(node, 0);
+    result->mInitialExpression = BuildChild<ExpressionNode>(node, 1);
+    result->mCondition = BuildChild<ExpressionNode>(node, 2);
+    result->mIterator = BuildChild<ExpressionNode>(node, 3);
+    result->mScope = BuildChild<ScopeNode>(node, 4);
+    return std::move(result);
+  }
+  case FlatNodeKind::Literal:
+  {
+    auto&& result = std::make_unique<LiteralNode>();
+    result->mToken = BuildToken(node);
+    return std::move(result);
+  }
+  case FlatNodeKind::NameReference:
+  {
+    auto&& result = std::make_unique<NameReferenceNode>();
+    result->mName = BuildToken(node);
+    return std::move(result);
+  }
+  case FlatNodeKind::BinaryOperator:
+  {
+    auto&& result = std::make_unique<BinaryOperatorNode>();
+    result->mOperator = BuildToken(node);
+    result->mLeft = BuildChild<ExpressionNode>(node, 0);
+    result->mRight = BuildChild<ExpressionNode>(node, 1);
+    return std::move(result);
+  }
+  case FlatNodeKind::UnaryOperator:
+  {
+    auto&& result = std::make_unique<UnaryOperatorNode>();
+    result->mOperator = BuildToken(node);
+    result->mRight = BuildChild<ExpressionNode>(node, 0);
+    return std::move(result);
+  }
+  case FlatNodeKind::MemberAccess:
+  {
+    auto&& result = std::make_unique<MemberAccessNode>();
+    result->mOperator = BuildToken(node, 0);
+    result->mName = BuildToken(node, 1);
+    result->mLeft = BuildChild<ExpressionNode>(node, 0);
+    return std::move(result);
+  }
+  case FlatNodeKind::Call:
+  {
+    auto&& result = std::make_unique<CallNode>();
+    result->mLeft = BuildChild<ExpressionNode>(node, 0);
+    BuildList(node, result->mArguments);
+    return std::move(result);
+  }
+  case FlatNodeKind::Cast:
+  {
+    auto&& result = std::make_unique<CastNode>();
+    result->mLeft = BuildChild<ExpressionNode>(node, 0);
+    result->mType = BuildChild<TypeNode>(node, 1);
+    return std::move(result);
+  }
+  case FlatNodeKind::Index:
+  {
+    auto&& result = std::make_unique<IndexNode>();
+    result->mLeft = BuildChild<ExpressionNode>(node, 0);
+    result->mIndex = BuildChild<ExpressionNode>(node, 1);
+    return std::move(result);
+  }
+  default:
+    return nullptr;
+  }
+}
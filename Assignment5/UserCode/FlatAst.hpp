@@ -0,0 +1,143 @@
+#pragma once
+
+#include "../Drivers/AstNodes.hpp"
+#include "TokenBuffer.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// The node types the parser creates (one per concrete class in AstNodes.hpp)
+namespace FlatNodeKind
+{
+  enum Enum : uint8_t
+  {
+    Block,
+    Class,
+    Variable,
+    Parameter,
+    Scope,
+    Function,
+    PointerType,
+    ReferenceType,
+    NamedType,
+    FunctionType,
+    Label,
+    Goto,
+    Return,
+    Break,
+    Continue,
+    If,
+    While,
+    For,
+    Literal,
+    NameReference,
+    BinaryOperator,
+    UnaryOperator,
+    MemberAccess,
+    Call,
+    Cast,
+    Index,
+    EnumCount
+  };
+}
+
+// The index of a node in a FlatAst
+typedef uint32_t FlatNodeId;
+// Stands in for a child that is null
+const FlatNodeId cNullFlatNode = 0xFFFFFFFF;
+
+// An AST kept as parallel arrays with the nodes in pre-order (the order Walk visits them), so a pass can go over every
+// node with a plain loop, and the subtree of a node is the range [node, GetSubtreeEnd(node))
+// Each kind has a fixed number of tokens and child slots, and some also end with a list of children:
+//   Block: globals...                    Class (name): members...           Scope: statements...
+//   Variable, Parameter (name): type, initial value
+//   Function (name): return type, scope, parameters...
+//   PointerType, ReferenceType: the type pointed to     NamedType (name)
+//   FunctionType: return type, parameters...
+//   Label, Goto (name)   Return: value   Break, Continue
+//   If: condition, scope, else     While: condition, scope
+//   For: initial variable, initial expression, condition, iterator, scope
+//   Literal (token)   NameReference (name)   BinaryOperator (operator): left, right   UnaryOperator (operator): right
+//   MemberAccess (operator, name): left   Call: left, arguments...   Cast: left, type   Index: left, index
+// Only the syntax is kept: symbols, resolved types and interpreter values belong to the passes run over a tree
+// Tokens are kept as TokenIds into the TokenBuffer the tree was parsed from, so that buffer must outlive the FlatAst
+class FlatAst
+{
+public:
+  FlatAst();
+
+  // Replaces the contents with the tree, which must have been parsed from the tokens (the tree is only read)
+  void Flatten(AbstractNode* root, const TokenBuffer& tokens);
+
+  // Builds a new tree from the node and everything under it (the whole tree by default)
+  // Its tokens are the ones the parser gave the original nodes (rebuilt from the buffer like the parser does)
+  std::unique_ptr<AbstractNode> Unflatten(FlatNodeId root = 0) const;
+
+  void Clear();
+
+  size_t GetNodeCount() const
+  {
+    return mKinds.size();
+  }
+
+  FlatNodeKind::Enum GetKind(FlatNodeId node) const
+  {
+    return (FlatNodeKind::Enum)mKinds[node];
+  }
+
+  // One past the last node under this one
+  FlatNodeId GetSubtreeEnd(FlatNodeId node) const
+  {
+    return mSubtreeEnds[node];
+  }
+
+  // The node's tokens, in the order listed above
+  TokenId GetToken(FlatNodeId node, size_t index = 0) const
+  {
+    return mTokens[mFirstTokens[node] + index];
+  }
+
+  // The buffer the tokens are in (null while empty)
+  const TokenBuffer* GetTokenBuffer() const
+  {
+    return mTokenBuffer;
+  }
+
+  // Fixed slots and list entries together
+  size_t GetChildCount(FlatNodeId node) const
+  {
+    return mChildBegins[node + 1] - mChildBegins[node];
+  }
+
+  // The child in the slot, or cNullFlatNode
+  FlatNodeId GetChild(FlatNodeId node, size_t slot) const
+  {
+    return mChildren[mChildBegins[node] + slot];
+  }
+
+  // Where a kind's list of children starts (every slot from here on is part of the list)
+  static size_t GetFixedChildCount(FlatNodeKind::Enum kind);
+  static size_t GetTokenCount(FlatNodeKind::Enum kind);
+
+private:
+  friend class FlattenVisitor;
+
+  std::unique_ptr<AbstractNode> Build(FlatNodeId node) const;
+  Token BuildToken(FlatNodeId node, size_t index = 0) const;
+  template <typename NodeType>
+  std::unique_ptr<NodeType> BuildChild(FlatNodeId node, size_t slot) const;
+  template <typename NodeType>
+  void BuildList(FlatNodeId node, unique_vector<NodeType>& nodes) const;
+
+  // Indexed by node
+  std::vector<uint8_t> mKinds;
+  std::vector<uint32_t> mFirstTokens;
+  std::vector<FlatNodeId> mSubtreeEnds;
+  // Indexed by node, plus one more entry so a node's slots are [mChildBegins[node], mChildBegins[node + 1])
+  std::vector<uint32_t> mChildBegins;
+
+  std::vector<FlatNodeId> mChildren;
+  const TokenBuffer* mTokenBuffer;
+  std::vector<TokenId> mTokens;
+};
@@ -0,0 +1,10403 @@
+// Generated by WriteDirectCodedScanner (ScannerGenerator.cpp), do not edit by hand
+// States: 524, byte classes: 59
+void ReadDirectCodedToken(const char* stream, Token& outToken)
+{
+  const char* position = stream;
+  const char* accepted = stream;
+  int acceptedToken = 0;
+
+  switch ((unsigned char)*position)
+  {
+  case 0x09: case 0x0A: case 0x0D: case 0x20:
+    goto state43;
+  case '!':
+    goto state12;
+  case '"':
+    goto state3;
+  case '%':
+    goto state4;
+  case '&':
+    goto state10;
+  case 0x27:
+    goto state2;
+  case '(':
+    goto state25;
+  case ')':
+    goto state24;
+  case '*':
+    goto state6;
+  case '+':
+    goto state11;
+  case ',':
+    goto state19;
+  case '-':
+    goto state16;
+  case '.':
+    goto state17;
+  case '/':
+    goto state5;
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9':
+    goto state28;
+  case ':':
+    goto state20;
+  case ';':
+    goto state21;
+  case '<':
+    goto state14;
+  case '=':
+    goto state15;
+  case '>':
+    goto state13;
+  case '?':
+    goto state18;
+  case 'A': case 'B': case 'C': case 'D': case 'E': case 'F': case 'G': case 'H':
+  case 'I': case 'J': case 'K': case 'L': case 'M': case 'N': case 'O': case 'P':
+  case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V': case 'W': case 'X':
+  case 'Y': case 'Z': case '_': case 'h': case 'j': case 'k': case 'q': case 'z':
+    goto state36;
+  case '[':
+    goto state23;
+  case ']':
+    goto state22;
+  case '^':
+    goto state7;
+  case 'a':
+    goto state44;
+  case 'b':
+    goto state47;
+  case 'c':
+    goto state48;
+  case 'd':
+    goto state46;
+  case 'e':
+    goto state45;
+  case 'f':
+    goto state49;
+  case 'g':
+    goto state50;
+  case 'i':
+    goto state51;
+  case 'l':
+    goto state41;
+  case 'm':
+    goto state40;
+  case 'n':
+    goto state39;
+  case 'o':
+    goto state38;
+  case 'p':
+    goto state37;
+  case 'r':
+    goto state35;
+  case 's':
+    goto state34;
+  case 't':
+    goto state33;
+  case 'u':
+    goto state32;
+  case 'v':
+    goto state31;
+  case 'w':
+    goto state42;
+  case 'x':
+    goto state30;
+  case 'y':
+    goto state29;
+  case '{':
+    goto state27;
+  case '|':
+    goto state9;
+  case '}':
+    goto state26;
+  case '~':
+    goto state8;
+  default:
+    goto done;
+  }
+
+state2:
+  ++position;
+  switch ((unsigned char)*position)
+  {
+  case 0x00:
+    goto done;
+  default:
+    goto state52;
+  }
+
+state3:
+  ++position;
+  switch ((unsigned char)*position)
+  {
+  case 0x00:
+    goto done;
+  default:
+    goto state53;
+  }
+
+state4:
+  ++position;
+  acceptedToken = TokenType::Modulo;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '=':
+    goto state54;
+  default:
+    goto done;
+  }
+
+state5:
+  ++position;
+  acceptedToken = TokenType::Divide;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '*':
+    goto state55;
+  case '/':
+    goto state56;
+  case '=':
+    goto state57;
+  default:
+    goto done;
+  }
+
+state6:
+  ++position;
+  acceptedToken = TokenType::Asterisk;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '=':
+    goto state58;
+  default:
+    goto done;
+  }
+
+state7:
+  ++position;
+  acceptedToken = TokenType::BitwiseXor;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '=':
+    goto state59;
+  default:
+    goto done;
+  }
+
+state8:
+  ++position;
+  acceptedToken = TokenType::BitwiseNot;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state9:
+  ++position;
+  acceptedToken = TokenType::BitwiseOr;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '=':
+    goto state60;
+  case '|':
+    goto state61;
+  default:
+    goto done;
+  }
+
+state10:
+  ++position;
+  acceptedToken = TokenType::Ampersand;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '&':
+    goto state63;
+  case '=':
+    goto state62;
+  default:
+    goto done;
+  }
+
+state11:
+  ++position;
+  acceptedToken = TokenType::Plus;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '+':
+    goto state65;
+  case '=':
+    goto state64;
+  default:
+    goto done;
+  }
+
+state12:
+  ++position;
+  acceptedToken = TokenType::LogicalNot;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '=':
+    goto state66;
+  default:
+    goto done;
+  }
+
+state13:
+  ++position;
+  acceptedToken = TokenType::GreaterThan;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '=':
+    goto state68;
+  case '>':
+    goto state67;
+  default:
+    goto done;
+  }
+
+state14:
+  ++position;
+  acceptedToken = TokenType::LessThan;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '<':
+    goto state69;
+  case '=':
+    goto state70;
+  default:
+    goto done;
+  }
+
+state15:
+  ++position;
+  acceptedToken = TokenType::Assignment;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '=':
+    goto state71;
+  default:
+    goto done;
+  }
+
+state16:
+  ++position;
+  acceptedToken = TokenType::Minus;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '-':
+    goto state73;
+  case '=':
+    goto state72;
+  case '>':
+    goto state74;
+  default:
+    goto done;
+  }
+
+state17:
+  ++position;
+  acceptedToken = TokenType::Dot;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state18:
+  ++position;
+  acceptedToken = TokenType::Ternary;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state19:
+  ++position;
+  acceptedToken = TokenType::Comma;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state20:
+  ++position;
+  acceptedToken = TokenType::Colon;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case ':':
+    goto state75;
+  default:
+    goto done;
+  }
+
+state21:
+  ++position;
+  acceptedToken = TokenType::Semicolon;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state22:
+  ++position;
+  acceptedToken = TokenType::CloseBracket;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state23:
+  ++position;
+  acceptedToken = TokenType::OpenBracket;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state24:
+  ++position;
+  acceptedToken = TokenType::CloseParentheses;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state25:
+  ++position;
+  acceptedToken = TokenType::OpenParentheses;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state26:
+  ++position;
+  acceptedToken = TokenType::CloseCurley;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state27:
+  ++position;
+  acceptedToken = TokenType::OpenCurley;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state28:
+  ++position;
+  acceptedToken = TokenType::IntegerLiteral;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '.':
+    goto state76;
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9':
+    goto state28;
+  default:
+    goto done;
+  }
+
+state29:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'i':
+    goto state77;
+  default:
+    goto done;
+  }
+
+state30:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'o':
+    goto state78;
+  default:
+    goto done;
+  }
+
+state31:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'j': case 'k': case 'l': case 'm':
+  case 'n': case 'p': case 'q': case 'r': case 's': case 't': case 'u': case 'v':
+  case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state80;
+  case 'i':
+    goto state81;
+  case 'o':
+    goto state79;
+  default:
+    goto done;
+  }
+
+state32:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'o': case 'p': case 'q': case 'r': case 't': case 'u':
+  case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'n':
+    goto state83;
+  case 's':
+    goto state82;
+  default:
+    goto done;
+  }
+
+state33:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'i': case 'j': case 'k': case 'l': case 'm':
+  case 'n': case 'o': case 'p': case 'q': case 's': case 't': case 'u': case 'v':
+  case 'w': case 'x': case 'z':
+    goto state36;
+  case 'e':
+    goto state86;
+  case 'h':
+    goto state87;
+  case 'r':
+    goto state85;
+  case 'y':
+    goto state84;
+  default:
+    goto done;
+  }
+
+state34:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'j': case 'k': case 'l': case 'm':
+  case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 'u': case 'v':
+  case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state90;
+  case 'i':
+    goto state91;
+  case 't':
+    goto state89;
+  case 'w':
+    goto state88;
+  default:
+    goto done;
+  }
+
+state35:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state92;
+  default:
+    goto done;
+  }
+
+state36:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state37:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 's': case 't': case 'v':
+  case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state95;
+  case 'r':
+    goto state94;
+  case 'u':
+    goto state93;
+  default:
+    goto done;
+  }
+
+state38:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'q': case 's': case 't': case 'w':
+  case 'x': case 'y': case 'z':
+    goto state36;
+  case 'p':
+    goto state99;
+  case 'r':
+    goto state98;
+  case 'u':
+    goto state97;
+  case 'v':
+    goto state96;
+  default:
+    goto done;
+  }
+
+state39:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l': case 'm':
+  case 'n': case 'p': case 'q': case 'r': case 's': case 't': case 'v': case 'w':
+  case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state102;
+  case 'e':
+    goto state103;
+  case 'o':
+    goto state101;
+  case 'u':
+    goto state100;
+  default:
+    goto done;
+  }
+
+state40:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'u':
+    goto state104;
+  default:
+    goto done;
+  }
+
+state41:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'p': case 'q': case 'r': case 's': case 't': case 'u':
+  case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state106;
+  case 'o':
+    goto state105;
+  default:
+    goto done;
+  }
+
+state42:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'h':
+    goto state107;
+  default:
+    goto done;
+  }
+
+state43:
+  ++position;
+  acceptedToken = TokenType::Whitespace;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case 0x09: case 0x0A: case 0x0D: case 0x20:
+    goto state43;
+  default:
+    goto done;
+  }
+
+state44:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'm':
+  case 'o': case 'p': case 'q': case 'r': case 't': case 'v': case 'w': case 'x':
+  case 'y': case 'z':
+    goto state36;
+  case 'b':
+    goto state111;
+  case 'l':
+    goto state112;
+  case 'n':
+    goto state110;
+  case 's':
+    goto state109;
+  case 'u':
+    goto state108;
+  default:
+    goto done;
+  }
+
+state45:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'm': case 'o': case 'p': case 'q': case 'r': case 's': case 't': case 'u':
+  case 'w': case 'y': case 'z':
+    goto state36;
+  case 'l':
+    goto state116;
+  case 'n':
+    goto state115;
+  case 'v':
+    goto state114;
+  case 'x':
+    goto state113;
+  default:
+    goto done;
+  }
+
+state46:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'p': case 'q': case 'r': case 's': case 't': case 'u':
+  case 'v': case 'w': case 'x': case 'z':
+    goto state36;
+  case 'e':
+    goto state119;
+  case 'o':
+    goto state118;
+  case 'y':
+    goto state117;
+  default:
+    goto done;
+  }
+
+state47:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 's': case 't': case 'u':
+  case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state121;
+  case 'r':
+    goto state120;
+  default:
+    goto done;
+  }
+
+state48:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'i': case 'j': case 'k': case 'm': case 'n':
+  case 'p': case 'q': case 'r': case 's': case 't': case 'u': case 'v': case 'w':
+  case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state123;
+  case 'h':
+    goto state124;
+  case 'l':
+    goto state125;
+  case 'o':
+    goto state122;
+  default:
+    goto done;
+  }
+
+state49:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'j': case 'k': case 'l': case 'm':
+  case 'n': case 'p': case 'q': case 's': case 't': case 'v': case 'w': case 'x':
+  case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state129;
+  case 'i':
+    goto state130;
+  case 'o':
+    goto state128;
+  case 'r':
+    goto state127;
+  case 'u':
+    goto state126;
+  default:
+    goto done;
+  }
+
+state50:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'm':
+  case 'n': case 'p': case 'q': case 'r': case 's': case 't': case 'u': case 'v':
+  case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state132;
+  case 'l':
+    goto state133;
+  case 'o':
+    goto state131;
+  default:
+    goto done;
+  }
+
+state51:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'o': case 'p': case 'q': case 'r': case 't': case 'u': case 'v': case 'w':
+  case 'x': case 'y': case 'z':
+    goto state36;
+  case 'f':
+    goto state136;
+  case 'm':
+    goto state137;
+  case 'n':
+    goto state135;
+  case 's':
+    goto state134;
+  default:
+    goto done;
+  }
+
+state52:
+  ++position;
+  switch ((unsigned char)*position)
+  {
+  case 0x00:
+    goto done;
+  case 0x27:
+    goto state138;
+  default:
+    goto state52;
+  }
+
+state53:
+  ++position;
+  switch ((unsigned char)*position)
+  {
+  case 0x00:
+    goto done;
+  case '"':
+    goto state139;
+  case 0x5C:
+    goto state140;
+  default:
+    goto state53;
+  }
+
+state54:
+  ++position;
+  acceptedToken = TokenType::AssignmentModulo;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state55:
+  ++position;
+  switch ((unsigned char)*position)
+  {
+  case 0x00:
+    goto done;
+  case '*':
+    goto state141;
+  default:
+    goto state55;
+  }
+
+state56:
+  ++position;
+  switch ((unsigned char)*position)
+  {
+  case 0x00:
+    goto done;
+  case 0x0A: case 0x0D:
+    goto state142;
+  default:
+    goto state56;
+  }
+
+state57:
+  ++position;
+  acceptedToken = TokenType::AssignmentDivide;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state58:
+  ++position;
+  acceptedToken = TokenType::AssignmentMultiply;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state59:
+  ++position;
+  acceptedToken = TokenType::AssignmentBitwiseXor;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state60:
+  ++position;
+  acceptedToken = TokenType::AssignmentBitwiseOr;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state61:
+  ++position;
+  acceptedToken = TokenType::LogicalOr;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state62:
+  ++position;
+  acceptedToken = TokenType::AssignmentBitwiseAnd;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state63:
+  ++position;
+  acceptedToken = TokenType::LogicalAnd;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state64:
+  ++position;
+  acceptedToken = TokenType::AssignmentPlus;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state65:
+  ++position;
+  acceptedToken = TokenType::Increment;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state66:
+  ++position;
+  acceptedToken = TokenType::Inequality;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state67:
+  ++position;
+  acceptedToken = TokenType::BitshiftRight;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '=':
+    goto state143;
+  default:
+    goto done;
+  }
+
+state68:
+  ++position;
+  acceptedToken = TokenType::GreaterThanOrEqualTo;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state69:
+  ++position;
+  acceptedToken = TokenType::BitshiftLeft;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '=':
+    goto state144;
+  default:
+    goto done;
+  }
+
+state70:
+  ++position;
+  acceptedToken = TokenType::LessThanOrEqualTo;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state71:
+  ++position;
+  acceptedToken = TokenType::Equality;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state72:
+  ++position;
+  acceptedToken = TokenType::AssignmentMinus;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state73:
+  ++position;
+  acceptedToken = TokenType::Decrement;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state74:
+  ++position;
+  acceptedToken = TokenType::Arrow;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state75:
+  ++position;
+  acceptedToken = TokenType::ScopeResolution;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state76:
+  ++position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9':
+    goto state145;
+  default:
+    goto done;
+  }
+
+state77:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state146;
+  default:
+    goto done;
+  }
+
+state78:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'r':
+    goto state147;
+  default:
+    goto done;
+  }
+
+state79:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'l':
+    goto state148;
+  default:
+    goto done;
+  }
+
+state80:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'r':
+    goto state149;
+  default:
+    goto done;
+  }
+
+state81:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'r':
+    goto state150;
+  default:
+    goto done;
+  }
+
+state82:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'i':
+    goto state151;
+  default:
+    goto done;
+  }
+
+state83:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'j': case 'k': case 'l': case 'm':
+  case 'n': case 'o': case 'p': case 'q': case 'r': case 't': case 'u': case 'v':
+  case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'c':
+    goto state153;
+  case 'i':
+    goto state154;
+  case 's':
+    goto state152;
+  default:
+    goto done;
+  }
+
+state84:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'p':
+    goto state155;
+  default:
+    goto done;
+  }
+
+state85:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'v': case 'w': case 'x': case 'z':
+    goto state36;
+  case 'u':
+    goto state157;
+  case 'y':
+    goto state156;
+  default:
+    goto done;
+  }
+
+state86:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'm':
+    goto state158;
+  default:
+    goto done;
+  }
+
+state87:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'r':
+    goto state159;
+  default:
+    goto done;
+  }
+
+state88:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'i':
+    goto state160;
+  default:
+    goto done;
+  }
+
+state89:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 's': case 't': case 'u':
+  case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state162;
+  case 'r':
+    goto state161;
+  default:
+    goto done;
+  }
+
+state90:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 'u':
+  case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state164;
+  case 't':
+    goto state163;
+  default:
+    goto done;
+  }
+
+state91:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y':
+    goto state36;
+  case 'z':
+    goto state165;
+  default:
+    goto done;
+  }
+
+state92:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'h': case 'j': case 'k': case 'l': case 'm': case 'n': case 'o':
+  case 'p': case 'r': case 's': case 'u': case 'v': case 'w': case 'x': case 'y':
+  case 'z':
+    goto state36;
+  case 'a':
+    goto state168;
+  case 'f':
+    goto state169;
+  case 'g':
+    goto state170;
+  case 'i':
+    goto state171;
+  case 'q':
+    goto state167;
+  case 't':
+    goto state166;
+  default:
+    goto done;
+  }
+
+state93:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'b':
+    goto state172;
+  default:
+    goto done;
+  }
+
+state94:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'p': case 'q': case 'r': case 's': case 't': case 'u':
+  case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'i':
+    goto state174;
+  case 'o':
+    goto state173;
+  default:
+    goto done;
+  }
+
+state95:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'r':
+    goto state175;
+  default:
+    goto done;
+  }
+
+state96:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state176;
+  default:
+    goto done;
+  }
+
+state97:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state177;
+  default:
+    goto done;
+  }
+
+state98:
+  ++position;
+  acceptedToken = TokenType::Or;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state99:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state178;
+  default:
+    goto done;
+  }
+
+state100:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'l':
+    goto state179;
+  default:
+    goto done;
+  }
+
+state101:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 'u':
+  case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state181;
+  case 't':
+    goto state180;
+  default:
+    goto done;
+  }
+
+state102:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'm':
+    goto state182;
+  default:
+    goto done;
+  }
+
+state103:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'w':
+    goto state183;
+  default:
+    goto done;
+  }
+
+state104:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state184;
+  default:
+    goto done;
+  }
+
+state105:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'c':
+    goto state185;
+  default:
+    goto done;
+  }
+
+state106:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'b':
+    goto state186;
+  default:
+    goto done;
+  }
+
+state107:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'i':
+    goto state187;
+  default:
+    goto done;
+  }
+
+state108:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state188;
+  default:
+    goto done;
+  }
+
+state109:
+  ++position;
+  acceptedToken = TokenType::As;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'm':
+    goto state189;
+  default:
+    goto done;
+  }
+
+state110:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'd':
+    goto state190;
+  default:
+    goto done;
+  }
+
+state111:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 's':
+    goto state191;
+  default:
+    goto done;
+  }
+
+state112:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'i':
+    goto state192;
+  default:
+    goto done;
+  }
+
+state113:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'q': case 'r': case 's': case 'u':
+  case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'p':
+    goto state194;
+  case 't':
+    goto state193;
+  default:
+    goto done;
+  }
+
+state114:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state195;
+  default:
+    goto done;
+  }
+
+state115:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'u':
+    goto state196;
+  default:
+    goto done;
+  }
+
+state116:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 's':
+    goto state197;
+  default:
+    goto done;
+  }
+
+state117:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'n':
+    goto state198;
+  default:
+    goto done;
+  }
+
+state118:
+  ++position;
+  acceptedToken = TokenType::Do;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state119:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'd':
+  case 'e': case 'g': case 'h': case 'i': case 'j': case 'k': case 'm': case 'n':
+  case 'o': case 'p': case 'q': case 'r': case 's': case 't': case 'u': case 'v':
+  case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'c':
+    goto state199;
+  case 'f':
+    goto state200;
+  case 'l':
+    goto state201;
+  default:
+    goto done;
+  }
+
+state120:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state202;
+  default:
+    goto done;
+  }
+
+state121:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 's':
+    goto state203;
+  default:
+    goto done;
+  }
+
+state122:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'o': case 'p': case 'q': case 'r': case 's': case 't': case 'u':
+  case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'm':
+    goto state205;
+  case 'n':
+    goto state204;
+  default:
+    goto done;
+  }
+
+state123:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 'u':
+  case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 's':
+    goto state207;
+  case 't':
+    goto state206;
+  default:
+    goto done;
+  }
+
+state124:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state208;
+  default:
+    goto done;
+  }
+
+state125:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state209;
+  default:
+    goto done;
+  }
+
+state126:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'n':
+    goto state210;
+  default:
+    goto done;
+  }
+
+state127:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'i':
+    goto state211;
+  default:
+    goto done;
+  }
+
+state128:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'r':
+    goto state212;
+  default:
+    goto done;
+  }
+
+state129:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'l':
+    goto state213;
+  default:
+    goto done;
+  }
+
+state130:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'y': case 'z':
+    goto state36;
+  case 'n':
+    goto state215;
+  case 'x':
+    goto state214;
+  default:
+    goto done;
+  }
+
+state131:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state216;
+  default:
+    goto done;
+  }
+
+state132:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state217;
+  default:
+    goto done;
+  }
+
+state133:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'o':
+    goto state218;
+  default:
+    goto done;
+  }
+
+state134:
+  ++position;
+  acceptedToken = TokenType::Is;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state135:
+  ++position;
+  acceptedToken = TokenType::In;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 'u':
+  case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'l':
+    goto state220;
+  case 't':
+    goto state219;
+  default:
+    goto done;
+  }
+
+state136:
+  ++position;
+  acceptedToken = TokenType::If;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state137:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'p':
+    goto state221;
+  default:
+    goto done;
+  }
+
+state138:
+  ++position;
+  acceptedToken = TokenType::CharacterLiteral;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state139:
+  ++position;
+  acceptedToken = TokenType::StringLiteral;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state140:
+  ++position;
+  switch ((unsigned char)*position)
+  {
+  case '"': case 'n': case 'r': case 't':
+    goto state53;
+  default:
+    goto done;
+  }
+
+state141:
+  ++position;
+  switch ((unsigned char)*position)
+  {
+  case 0x00:
+    goto done;
+  case '/':
+    goto state222;
+  default:
+    goto state55;
+  }
+
+state142:
+  ++position;
+  acceptedToken = TokenType::SingleLineComment;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state143:
+  ++position;
+  acceptedToken = TokenType::AssignmentBitshiftRight;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state144:
+  ++position;
+  acceptedToken = TokenType::AssignmentBitshiftLeft;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state145:
+  ++position;
+  acceptedToken = TokenType::FloatLiteral;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9':
+    goto state145;
+  case 'e':
+    goto state224;
+  case 'f':
+    goto state223;
+  default:
+    goto done;
+  }
+
+state146:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'l':
+    goto state225;
+  default:
+    goto done;
+  }
+
+state147:
+  ++position;
+  acceptedToken = TokenType::Xor;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state148:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state226;
+  default:
+    goto done;
+  }
+
+state149:
+  ++position;
+  acceptedToken = TokenType::Var;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state150:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state227;
+  default:
+    goto done;
+  }
+
+state151:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'n':
+    goto state228;
+  default:
+    goto done;
+  }
+
+state152:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state229;
+  default:
+    goto done;
+  }
+
+state153:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'h':
+    goto state230;
+  default:
+    goto done;
+  }
+
+state154:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'o':
+    goto state231;
+  default:
+    goto done;
+  }
+
+state155:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state232;
+  default:
+    goto done;
+  }
+
+state156:
+  ++position;
+  acceptedToken = TokenType::Try;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state157:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state233;
+  default:
+    goto done;
+  }
+
+state158:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'p':
+    goto state234;
+  default:
+    goto done;
+  }
+
+state159:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'p': case 'q': case 'r': case 's': case 't': case 'u':
+  case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state236;
+  case 'o':
+    goto state235;
+  default:
+    goto done;
+  }
+
+state160:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state237;
+  default:
+    goto done;
+  }
+
+state161:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'u':
+    goto state238;
+  default:
+    goto done;
+  }
+
+state162:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 'u':
+  case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'c':
+    goto state240;
+  case 't':
+    goto state239;
+  default:
+    goto done;
+  }
+
+state163:
+  ++position;
+  acceptedToken = TokenType::Set;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state164:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'l':
+    goto state241;
+  default:
+    goto done;
+  }
+
+state165:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state242;
+  default:
+    goto done;
+  }
+
+state166:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'u':
+    goto state243;
+  default:
+    goto done;
+  }
+
+state167:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'u':
+    goto state244;
+  default:
+    goto done;
+  }
+
+state168:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'd':
+    goto state245;
+  default:
+    goto done;
+  }
+
+state169:
+  ++position;
+  acceptedToken = TokenType::Ref;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state170:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'i':
+    goto state246;
+  default:
+    goto done;
+  }
+
+state171:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'n':
+    goto state247;
+  default:
+    goto done;
+  }
+
+state172:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'l':
+    goto state248;
+  default:
+    goto done;
+  }
+
+state173:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state249;
+  default:
+    goto done;
+  }
+
+state174:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'v':
+    goto state250;
+  default:
+    goto done;
+  }
+
+state175:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 'u':
+  case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state252;
+  case 't':
+    goto state251;
+  default:
+    goto done;
+  }
+
+state176:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'r':
+    goto state253;
+  default:
+    goto done;
+  }
+
+state177:
+  ++position;
+  acceptedToken = TokenType::Out;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state178:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'r':
+    goto state254;
+  default:
+    goto done;
+  }
+
+state179:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'l':
+    goto state255;
+  default:
+    goto done;
+  }
+
+state180:
+  ++position;
+  acceptedToken = TokenType::Not;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state181:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'y': case 'z':
+    goto state36;
+  case 'x':
+    goto state256;
+  default:
+    goto done;
+  }
+
+state182:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state257;
+  default:
+    goto done;
+  }
+
+state183:
+  ++position;
+  acceptedToken = TokenType::New;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state184:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state258;
+  default:
+    goto done;
+  }
+
+state185:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'k':
+    goto state259;
+  default:
+    goto done;
+  }
+
+state186:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state260;
+  default:
+    goto done;
+  }
+
+state187:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'l':
+    goto state261;
+  default:
+    goto done;
+  }
+
+state188:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'o':
+    goto state262;
+  default:
+    goto done;
+  }
+
+state189:
+  ++position;
+  acceptedToken = TokenType::Asm;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state190:
+  ++position;
+  acceptedToken = TokenType::And;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state191:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state263;
+  default:
+    goto done;
+  }
+
+state192:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'h': case 'i': case 'j': case 'k': case 'l': case 'm':
+  case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't': case 'u':
+  case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state264;
+  case 'g':
+    goto state265;
+  default:
+    goto done;
+  }
+
+state193:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state266;
+  default:
+    goto done;
+  }
+
+state194:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'm': case 'n': case 'p': case 'q': case 'r': case 's': case 't': case 'u':
+  case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'l':
+    goto state268;
+  case 'o':
+    goto state267;
+  default:
+    goto done;
+  }
+
+state195:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'n':
+    goto state269;
+  default:
+    goto done;
+  }
+
+state196:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'm':
+    goto state270;
+  default:
+    goto done;
+  }
+
+state197:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state271;
+  default:
+    goto done;
+  }
+
+state198:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state272;
+  default:
+    goto done;
+  }
+
+state199:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'l':
+    goto state273;
+  default:
+    goto done;
+  }
+
+state200:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state274;
+  default:
+    goto done;
+  }
+
+state201:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state275;
+  default:
+    goto done;
+  }
+
+state202:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state276;
+  default:
+    goto done;
+  }
+
+state203:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state277;
+  default:
+    goto done;
+  }
+
+state204:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 'u': case 'v':
+  case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'c':
+    goto state280;
+  case 's':
+    goto state279;
+  case 't':
+    goto state278;
+  default:
+    goto done;
+  }
+
+state205:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'p':
+    goto state281;
+  default:
+    goto done;
+  }
+
+state206:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'c':
+    goto state282;
+  default:
+    goto done;
+  }
+
+state207:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state283;
+  default:
+    goto done;
+  }
+
+state208:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'c':
+    goto state284;
+  default:
+    goto done;
+  }
+
+state209:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 's':
+    goto state285;
+  default:
+    goto done;
+  }
+
+state210:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'c':
+    goto state286;
+  default:
+    goto done;
+  }
+
+state211:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state287;
+  default:
+    goto done;
+  }
+
+state212:
+  ++position;
+  acceptedToken = TokenType::For;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state288;
+  default:
+    goto done;
+  }
+
+state213:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 's':
+    goto state289;
+  default:
+    goto done;
+  }
+
+state214:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state290;
+  default:
+    goto done;
+  }
+
+state215:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state291;
+  default:
+    goto done;
+  }
+
+state216:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'o':
+    goto state292;
+  default:
+    goto done;
+  }
+
+state217:
+  ++position;
+  acceptedToken = TokenType::Get;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state218:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'b':
+    goto state293;
+  default:
+    goto done;
+  }
+
+state219:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state294;
+  default:
+    goto done;
+  }
+
+state220:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'i':
+    goto state295;
+  default:
+    goto done;
+  }
+
+state221:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'l':
+    goto state296;
+  default:
+    goto done;
+  }
+
+state222:
+  ++position;
+  acceptedToken = TokenType::MultiLineComment;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state223:
+  ++position;
+  acceptedToken = TokenType::FloatLiteral;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  default:
+    goto done;
+  }
+
+state224:
+  ++position;
+  switch ((unsigned char)*position)
+  {
+  case '+': case '-':
+    goto state298;
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9':
+    goto state297;
+  default:
+    goto done;
+  }
+
+state225:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'd':
+    goto state299;
+  default:
+    goto done;
+  }
+
+state226:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state300;
+  default:
+    goto done;
+  }
+
+state227:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'u':
+    goto state301;
+  default:
+    goto done;
+  }
+
+state228:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'g':
+    goto state302;
+  default:
+    goto done;
+  }
+
+state229:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'f':
+    goto state303;
+  default:
+    goto done;
+  }
+
+state230:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state304;
+  default:
+    goto done;
+  }
+
+state231:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'n':
+    goto state305;
+  default:
+    goto done;
+  }
+
+state232:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'e': case 'f': case 'g': case 'h': case 'j': case 'k': case 'l': case 'm':
+  case 'p': case 'q': case 'r': case 's': case 't': case 'u': case 'v': case 'w':
+  case 'x': case 'y': case 'z':
+    goto state36;
+  case 'd':
+    goto state308;
+  case 'i':
+    goto state309;
+  case 'n':
+    goto state307;
+  case 'o':
+    goto state306;
+  default:
+    goto done;
+  }
+
+state233:
+  ++position;
+  acceptedToken = TokenType::True;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state234:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'l':
+    goto state310;
+  default:
+    goto done;
+  }
+
+state235:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'w':
+    goto state311;
+  default:
+    goto done;
+  }
+
+state236:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state312;
+  default:
+    goto done;
+  }
+
+state237:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'c':
+    goto state313;
+  default:
+    goto done;
+  }
+
+state238:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'c':
+    goto state314;
+  default:
+    goto done;
+  }
+
+state239:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'i':
+    goto state315;
+  default:
+    goto done;
+  }
+
+state240:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'k':
+    goto state316;
+  default:
+    goto done;
+  }
+
+state241:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state317;
+  default:
+    goto done;
+  }
+
+state242:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'o':
+    goto state318;
+  default:
+    goto done;
+  }
+
+state243:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'r':
+    goto state319;
+  default:
+    goto done;
+  }
+
+state244:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'i':
+    goto state320;
+  default:
+    goto done;
+  }
+
+state245:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'o':
+    goto state321;
+  default:
+    goto done;
+  }
+
+state246:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 's':
+    goto state322;
+  default:
+    goto done;
+  }
+
+state247:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state323;
+  default:
+    goto done;
+  }
+
+state248:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'i':
+    goto state324;
+  default:
+    goto done;
+  }
+
+state249:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state325;
+  default:
+    goto done;
+  }
+
+state250:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state326;
+  default:
+    goto done;
+  }
+
+state251:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'i':
+    goto state327;
+  default:
+    goto done;
+  }
+
+state252:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'm':
+    goto state328;
+  default:
+    goto done;
+  }
+
+state253:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'r':
+    goto state329;
+  default:
+    goto done;
+  }
+
+state254:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state330;
+  default:
+    goto done;
+  }
+
+state255:
+  ++position;
+  acceptedToken = TokenType::Null;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state256:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'c':
+    goto state331;
+  default:
+    goto done;
+  }
+
+state257:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 's':
+    goto state332;
+  default:
+    goto done;
+  }
+
+state258:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'b':
+    goto state333;
+  default:
+    goto done;
+  }
+
+state259:
+  ++position;
+  acceptedToken = TokenType::Lock;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state260:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'l':
+    goto state334;
+  default:
+    goto done;
+  }
+
+state261:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state335;
+  default:
+    goto done;
+  }
+
+state262:
+  ++position;
+  acceptedToken = TokenType::Auto;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state263:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'r':
+    goto state336;
+  default:
+    goto done;
+  }
+
+state264:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 's':
+    goto state337;
+  default:
+    goto done;
+  }
+
+state265:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'n':
+    goto state338;
+  default:
+    goto done;
+  }
+
+state266:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'r':
+    goto state339;
+  default:
+    goto done;
+  }
+
+state267:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'r':
+    goto state340;
+  default:
+    goto done;
+  }
+
+state268:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'i':
+    goto state341;
+  default:
+    goto done;
+  }
+
+state269:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state342;
+  default:
+    goto done;
+  }
+
+state270:
+  ++position;
+  acceptedToken = TokenType::Enumeration;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state271:
+  ++position;
+  acceptedToken = TokenType::Else;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state272:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'm':
+    goto state343;
+  default:
+    goto done;
+  }
+
+state273:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state344;
+  default:
+    goto done;
+  }
+
+state274:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'u':
+    goto state345;
+  default:
+    goto done;
+  }
+
+state275:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 'u':
+  case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'g':
+    goto state347;
+  case 't':
+    goto state346;
+  default:
+    goto done;
+  }
+
+state276:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'k':
+    goto state348;
+  default:
+    goto done;
+  }
+
+state277:
+  ++position;
+  acceptedToken = TokenType::Base;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state278:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'i':
+    goto state349;
+  default:
+    goto done;
+  }
+
+state279:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state350;
+  default:
+    goto done;
+  }
+
+state280:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state351;
+  default:
+    goto done;
+  }
+
+state281:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'l':
+    goto state352;
+  default:
+    goto done;
+  }
+
+state282:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'h':
+    goto state353;
+  default:
+    goto done;
+  }
+
+state283:
+  ++position;
+  acceptedToken = TokenType::Case;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state284:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'k':
+    goto state354;
+  default:
+    goto done;
+  }
+
+state285:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 's':
+    goto state355;
+  default:
+    goto done;
+  }
+
+state286:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state356;
+  default:
+    goto done;
+  }
+
+state287:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'n':
+    goto state357;
+  default:
+    goto done;
+  }
+
+state288:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state358;
+  default:
+    goto done;
+  }
+
+state289:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state359;
+  default:
+    goto done;
+  }
+
+state290:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'd':
+    goto state360;
+  default:
+    goto done;
+  }
+
+state291:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'l':
+    goto state361;
+  default:
+    goto done;
+  }
+
+state292:
+  ++position;
+  acceptedToken = TokenType::Goto;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state293:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state362;
+  default:
+    goto done;
+  }
+
+state294:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'r':
+    goto state363;
+  default:
+    goto done;
+  }
+
+state295:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'n':
+    goto state364;
+  default:
+    goto done;
+  }
+
+state296:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'i':
+    goto state365;
+  default:
+    goto done;
+  }
+
+state297:
+  ++position;
+  acceptedToken = TokenType::FloatLiteral;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9':
+    goto state297;
+  case 'f':
+    goto state223;
+  default:
+    goto done;
+  }
+
+state298:
+  ++position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9':
+    goto state297;
+  default:
+    goto done;
+  }
+
+state299:
+  ++position;
+  acceptedToken = TokenType::Yield;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state300:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'i':
+    goto state366;
+  default:
+    goto done;
+  }
+
+state301:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state367;
+  default:
+    goto done;
+  }
+
+state302:
+  ++position;
+  acceptedToken = TokenType::Using;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state303:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state368;
+  default:
+    goto done;
+  }
+
+state304:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'c':
+    goto state369;
+  default:
+    goto done;
+  }
+
+state305:
+  ++position;
+  acceptedToken = TokenType::Union;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state306:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'f':
+    goto state370;
+  default:
+    goto done;
+  }
+
+state307:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state371;
+  default:
+    goto done;
+  }
+
+state308:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state372;
+  default:
+    goto done;
+  }
+
+state309:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'd':
+    goto state373;
+  default:
+    goto done;
+  }
+
+state310:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state374;
+  default:
+    goto done;
+  }
+
+state311:
+  ++position;
+  acceptedToken = TokenType::Throw;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state312:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'd':
+    goto state375;
+  default:
+    goto done;
+  }
+
+state313:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'h':
+    goto state376;
+  default:
+    goto done;
+  }
+
+state314:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state377;
+  default:
+    goto done;
+  }
+
+state315:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'c':
+    goto state378;
+  default:
+    goto done;
+  }
+
+state316:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state379;
+  default:
+    goto done;
+  }
+
+state317:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'd':
+    goto state380;
+  default:
+    goto done;
+  }
+
+state318:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'f':
+    goto state381;
+  default:
+    goto done;
+  }
+
+state319:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'n':
+    goto state382;
+  default:
+    goto done;
+  }
+
+state320:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'r':
+    goto state383;
+  default:
+    goto done;
+  }
+
+state321:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'n':
+    goto state384;
+  default:
+    goto done;
+  }
+
+state322:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state385;
+  default:
+    goto done;
+  }
+
+state323:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state386;
+  default:
+    goto done;
+  }
+
+state324:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'c':
+    goto state387;
+  default:
+    goto done;
+  }
+
+state325:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'c':
+    goto state388;
+  default:
+    goto done;
+  }
+
+state326:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state389;
+  default:
+    goto done;
+  }
+
+state327:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state390;
+  default:
+    goto done;
+  }
+
+state328:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 's':
+    goto state391;
+  default:
+    goto done;
+  }
+
+state329:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'i':
+    goto state392;
+  default:
+    goto done;
+  }
+
+state330:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state393;
+  default:
+    goto done;
+  }
+
+state331:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state394;
+  default:
+    goto done;
+  }
+
+state332:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'p':
+    goto state395;
+  default:
+    goto done;
+  }
+
+state333:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'l':
+    goto state396;
+  default:
+    goto done;
+  }
+
+state334:
+  ++position;
+  acceptedToken = TokenType::Label;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state335:
+  ++position;
+  acceptedToken = TokenType::While;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state336:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state397;
+  default:
+    goto done;
+  }
+
+state337:
+  ++position;
+  acceptedToken = TokenType::Alias;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state338:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'p': case 'q': case 'r': case 's': case 't': case 'u':
+  case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state399;
+  case 'o':
+    goto state398;
+  default:
+    goto done;
+  }
+
+state339:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'n':
+    goto state400;
+  default:
+    goto done;
+  }
+
+state340:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state401;
+  default:
+    goto done;
+  }
+
+state341:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'c':
+    goto state402;
+  default:
+    goto done;
+  }
+
+state342:
+  ++position;
+  acceptedToken = TokenType::Event;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state343:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'i':
+    goto state403;
+  default:
+    goto done;
+  }
+
+state344:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'z':
+    goto state36;
+  case 'y':
+    goto state404;
+  default:
+    goto done;
+  }
+
+state345:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'l':
+    goto state405;
+  default:
+    goto done;
+  }
+
+state346:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state406;
+  default:
+    goto done;
+  }
+
+state347:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state407;
+  default:
+    goto done;
+  }
+
+state348:
+  ++position;
+  acceptedToken = TokenType::Break;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state349:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'n':
+    goto state408;
+  default:
+    goto done;
+  }
+
+state350:
+  ++position;
+  acceptedToken = TokenType::Const;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case 'a': case 'b': case 'c': case 'd':
+  case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l': case 'm':
+  case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't': case 'u':
+  case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case '_':
+    goto state410;
+  case 'e':
+    goto state409;
+  default:
+    goto done;
+  }
+
+state351:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'p':
+    goto state411;
+  default:
+    goto done;
+  }
+
+state352:
+  ++position;
+  acceptedToken = TokenType::Compl;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state353:
+  ++position;
+  acceptedToken = TokenType::Catch;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state354:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state412;
+  default:
+    goto done;
+  }
+
+state355:
+  ++position;
+  acceptedToken = TokenType::Class;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state356:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'i':
+    goto state413;
+  default:
+    goto done;
+  }
+
+state357:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'd':
+    goto state414;
+  default:
+    goto done;
+  }
+
+state358:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'c':
+    goto state415;
+  default:
+    goto done;
+  }
+
+state359:
+  ++position;
+  acceptedToken = TokenType::False;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state360:
+  ++position;
+  acceptedToken = TokenType::Fixed;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state361:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'l':
+    goto state416;
+  default:
+    goto done;
+  }
+
+state362:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'l':
+    goto state417;
+  default:
+    goto done;
+  }
+
+state363:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'o': case 'p': case 'q': case 'r': case 's': case 't': case 'u':
+  case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'f':
+    goto state419;
+  case 'n':
+    goto state418;
+  default:
+    goto done;
+  }
+
+state364:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state420;
+  default:
+    goto done;
+  }
+
+state365:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'c':
+    goto state421;
+  default:
+    goto done;
+  }
+
+state366:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'l':
+    goto state422;
+  default:
+    goto done;
+  }
+
+state367:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'l':
+    goto state423;
+  default:
+    goto done;
+  }
+
+state368:
+  ++position;
+  acceptedToken = TokenType::Unsafe;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state369:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'k':
+    goto state424;
+  default:
+    goto done;
+  }
+
+state370:
+  ++position;
+  acceptedToken = TokenType::Typeof;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state371:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'm':
+    goto state425;
+  default:
+    goto done;
+  }
+
+state372:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'f':
+    goto state426;
+  default:
+    goto done;
+  }
+
+state373:
+  ++position;
+  acceptedToken = TokenType::Typeid;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state374:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state427;
+  default:
+    goto done;
+  }
+
+state375:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case 'a': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case '_':
+    goto state428;
+  default:
+    goto done;
+  }
+
+state376:
+  ++position;
+  acceptedToken = TokenType::Switch;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state377:
+  ++position;
+  acceptedToken = TokenType::Struct;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state378:
+  ++position;
+  acceptedToken = TokenType::Static;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case 'a': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case '_':
+    goto state429;
+  default:
+    goto done;
+  }
+
+state379:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'l':
+    goto state430;
+  default:
+    goto done;
+  }
+
+state380:
+  ++position;
+  acceptedToken = TokenType::Sealed;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state381:
+  ++position;
+  acceptedToken = TokenType::Sizeof;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state382:
+  ++position;
+  acceptedToken = TokenType::Return;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state383:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state431;
+  default:
+    goto done;
+  }
+
+state384:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'l':
+    goto state432;
+  default:
+    goto done;
+  }
+
+state385:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state433;
+  default:
+    goto done;
+  }
+
+state386:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'r':
+    goto state434;
+  default:
+    goto done;
+  }
+
+state387:
+  ++position;
+  acceptedToken = TokenType::Public;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state388:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state435;
+  default:
+    goto done;
+  }
+
+state389:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state436;
+  default:
+    goto done;
+  }
+
+state390:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'l':
+    goto state437;
+  default:
+    goto done;
+  }
+
+state391:
+  ++position;
+  acceptedToken = TokenType::Params;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state392:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'd':
+    goto state438;
+  default:
+    goto done;
+  }
+
+state393:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'o':
+    goto state439;
+  default:
+    goto done;
+  }
+
+state394:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'p':
+    goto state440;
+  default:
+    goto done;
+  }
+
+state395:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state441;
+  default:
+    goto done;
+  }
+
+state396:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state442;
+  default:
+    goto done;
+  }
+
+state397:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'c':
+    goto state443;
+  default:
+    goto done;
+  }
+
+state398:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'f':
+    goto state444;
+  default:
+    goto done;
+  }
+
+state399:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 's':
+    goto state445;
+  default:
+    goto done;
+  }
+
+state400:
+  ++position;
+  acceptedToken = TokenType::Extern;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state401:
+  ++position;
+  acceptedToken = TokenType::Export;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state402:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'i':
+    goto state446;
+  default:
+    goto done;
+  }
+
+state403:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'c':
+    goto state447;
+  default:
+    goto done;
+  }
+
+state404:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'p':
+    goto state448;
+  default:
+    goto done;
+  }
+
+state405:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state449;
+  default:
+    goto done;
+  }
+
+state406:
+  ++position;
+  acceptedToken = TokenType::Delete;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state407:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state450;
+  default:
+    goto done;
+  }
+
+state408:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'u':
+    goto state451;
+  default:
+    goto done;
+  }
+
+state409:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'y': case 'z':
+    goto state36;
+  case 'x':
+    goto state452;
+  default:
+    goto done;
+  }
+
+state410:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'c':
+    goto state453;
+  default:
+    goto done;
+  }
+
+state411:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state454;
+  default:
+    goto done;
+  }
+
+state412:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'd':
+    goto state455;
+  default:
+    goto done;
+  }
+
+state413:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'o':
+    goto state456;
+  default:
+    goto done;
+  }
+
+state414:
+  ++position;
+  acceptedToken = TokenType::Friend;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state415:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'h':
+    goto state457;
+  default:
+    goto done;
+  }
+
+state416:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'z':
+    goto state36;
+  case 'y':
+    goto state458;
+  default:
+    goto done;
+  }
+
+state417:
+  ++position;
+  acceptedToken = TokenType::Global;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state418:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state459;
+  default:
+    goto done;
+  }
+
+state419:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state460;
+  default:
+    goto done;
+  }
+
+state420:
+  ++position;
+  acceptedToken = TokenType::Inline;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state421:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'i':
+    goto state461;
+  default:
+    goto done;
+  }
+
+state422:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state462;
+  default:
+    goto done;
+  }
+
+state423:
+  ++position;
+  acceptedToken = TokenType::Virtual;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state424:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state463;
+  default:
+    goto done;
+  }
+
+state425:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state464;
+  default:
+    goto done;
+  }
+
+state426:
+  ++position;
+  acceptedToken = TokenType::Typedef;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state427:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state465;
+  default:
+    goto done;
+  }
+
+state428:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'l':
+    goto state466;
+  default:
+    goto done;
+  }
+
+state429:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'd': case 'e':
+  case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l': case 'm':
+  case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't': case 'u':
+  case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state467;
+  case 'c':
+    goto state468;
+  default:
+    goto done;
+  }
+
+state430:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'l':
+    goto state469;
+  default:
+    goto done;
+  }
+
+state431:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 's':
+    goto state470;
+  default:
+    goto done;
+  }
+
+state432:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'z':
+    goto state36;
+  case 'y':
+    goto state471;
+  default:
+    goto done;
+  }
+
+state433:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'r':
+    goto state472;
+  default:
+    goto done;
+  }
+
+state434:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'p':
+    goto state473;
+  default:
+    goto done;
+  }
+
+state435:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state474;
+  default:
+    goto done;
+  }
+
+state436:
+  ++position;
+  acceptedToken = TokenType::Private;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state437:
+  ++position;
+  acceptedToken = TokenType::Partial;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state438:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state475;
+  default:
+    goto done;
+  }
+
+state439:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'r':
+    goto state476;
+  default:
+    goto done;
+  }
+
+state440:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state477;
+  default:
+    goto done;
+  }
+
+state441:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'c':
+    goto state478;
+  default:
+    goto done;
+  }
+
+state442:
+  ++position;
+  acceptedToken = TokenType::Mutable;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state443:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state479;
+  default:
+    goto done;
+  }
+
+state444:
+  ++position;
+  acceptedToken = TokenType::Alignof;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state445:
+  ++position;
+  acceptedToken = TokenType::Alignas;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state446:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state480;
+  default:
+    goto done;
+  }
+
+state447:
+  ++position;
+  acceptedToken = TokenType::Dynamic;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case 'a': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case '_':
+    goto state481;
+  default:
+    goto done;
+  }
+
+state448:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state482;
+  default:
+    goto done;
+  }
+
+state449:
+  ++position;
+  acceptedToken = TokenType::Default;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state450:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state483;
+  default:
+    goto done;
+  }
+
+state451:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state484;
+  default:
+    goto done;
+  }
+
+state452:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'p':
+    goto state485;
+  default:
+    goto done;
+  }
+
+state453:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state486;
+  default:
+    goto done;
+  }
+
+state454:
+  ++position;
+  acceptedToken = TokenType::Concept;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state455:
+  ++position;
+  acceptedToken = TokenType::Checked;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state456:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'n':
+    goto state487;
+  default:
+    goto done;
+  }
+
+state457:
+  ++position;
+  acceptedToken = TokenType::Foreach;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state458:
+  ++position;
+  acceptedToken = TokenType::Finally;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state459:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'l':
+    goto state488;
+  default:
+    goto done;
+  }
+
+state460:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'c':
+    goto state489;
+  default:
+    goto done;
+  }
+
+state461:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state490;
+  default:
+    goto done;
+  }
+
+state462:
+  ++position;
+  acceptedToken = TokenType::Volatile;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state463:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'd':
+    goto state491;
+  default:
+    goto done;
+  }
+
+state464:
+  ++position;
+  acceptedToken = TokenType::Typename;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state465:
+  ++position;
+  acceptedToken = TokenType::Template;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state466:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'o':
+    goto state492;
+  default:
+    goto done;
+  }
+
+state467:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 's':
+    goto state493;
+  default:
+    goto done;
+  }
+
+state468:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state494;
+  default:
+    goto done;
+  }
+
+state469:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'o':
+    goto state495;
+  default:
+    goto done;
+  }
+
+state470:
+  ++position;
+  acceptedToken = TokenType::Requires;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state471:
+  ++position;
+  acceptedToken = TokenType::Readonly;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state472:
+  ++position;
+  acceptedToken = TokenType::Register;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state473:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'r':
+    goto state496;
+  default:
+    goto done;
+  }
+
+state474:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'd':
+    goto state497;
+  default:
+    goto done;
+  }
+
+state475:
+  ++position;
+  acceptedToken = TokenType::Override;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state476:
+  ++position;
+  acceptedToken = TokenType::Operator;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state477:
+  ++position;
+  acceptedToken = TokenType::Noexcept;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state478:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state498;
+  default:
+    goto done;
+  }
+
+state479:
+  ++position;
+  acceptedToken = TokenType::Abstract;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state480:
+  ++position;
+  acceptedToken = TokenType::Explicit;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state481:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'c':
+    goto state499;
+  default:
+    goto done;
+  }
+
+state482:
+  ++position;
+  acceptedToken = TokenType::Decltype;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state483:
+  ++position;
+  acceptedToken = TokenType::Delegate;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state484:
+  ++position;
+  acceptedToken = TokenType::Continue;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state485:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'r':
+    goto state500;
+  default:
+    goto done;
+  }
+
+state486:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 's':
+    goto state501;
+  default:
+    goto done;
+  }
+
+state487:
+  ++position;
+  acceptedToken = TokenType::Function;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state488:
+  ++position;
+  acceptedToken = TokenType::Internal;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state489:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state502;
+  default:
+    goto done;
+  }
+
+state490:
+  ++position;
+  acceptedToken = TokenType::Implicit;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state491:
+  ++position;
+  acceptedToken = TokenType::Unchecked;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state492:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'c':
+    goto state503;
+  default:
+    goto done;
+  }
+
+state493:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 's':
+    goto state504;
+  default:
+    goto done;
+  }
+
+state494:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 's':
+    goto state505;
+  default:
+    goto done;
+  }
+
+state495:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'c':
+    goto state506;
+  default:
+    goto done;
+  }
+
+state496:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state507;
+  default:
+    goto done;
+  }
+
+state497:
+  ++position;
+  acceptedToken = TokenType::Protected;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state498:
+  ++position;
+  acceptedToken = TokenType::Namespace;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state499:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state508;
+  default:
+    goto done;
+  }
+
+state500:
+  ++position;
+  acceptedToken = TokenType::Constexpr;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state501:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state509;
+  default:
+    goto done;
+  }
+
+state502:
+  ++position;
+  acceptedToken = TokenType::Interface;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state503:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state510;
+  default:
+    goto done;
+  }
+
+state504:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'e':
+    goto state511;
+  default:
+    goto done;
+  }
+
+state505:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state512;
+  default:
+    goto done;
+  }
+
+state506:
+  ++position;
+  acceptedToken = TokenType::Stackalloc;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state507:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state513;
+  default:
+    goto done;
+  }
+
+state508:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 's':
+    goto state514;
+  default:
+    goto done;
+  }
+
+state509:
+  ++position;
+  acceptedToken = TokenType::ConstCast;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state510:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'l':
+    goto state515;
+  default:
+    goto done;
+  }
+
+state511:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'r':
+    goto state516;
+  default:
+    goto done;
+  }
+
+state512:
+  ++position;
+  acceptedToken = TokenType::StaticCast;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state513:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case 'a': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case '_':
+    goto state517;
+  default:
+    goto done;
+  }
+
+state514:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state518;
+  default:
+    goto done;
+  }
+
+state515:
+  ++position;
+  acceptedToken = TokenType::ThreadLocal;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state516:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state519;
+  default:
+    goto done;
+  }
+
+state517:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'c':
+    goto state520;
+  default:
+    goto done;
+  }
+
+state518:
+  ++position;
+  acceptedToken = TokenType::DynamicCast;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state519:
+  ++position;
+  acceptedToken = TokenType::StaticAssert;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+state520:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+  case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+  case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 'a':
+    goto state521;
+  default:
+    goto done;
+  }
+
+state521:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 't':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 's':
+    goto state522;
+  default:
+    goto done;
+  }
+
+state522:
+  ++position;
+  acceptedToken = TokenType::Identifier;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  case 't':
+    goto state523;
+  default:
+    goto done;
+  }
+
+state523:
+  ++position;
+  acceptedToken = TokenType::ReinterpretCast;
+  accepted = position;
+  switch ((unsigned char)*position)
+  {
+  case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+  case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+  case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+  case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+  case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+  case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+  case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+  case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+    goto state36;
+  default:
+    goto done;
+  }
+
+done:
+  outToken.mText = stream;
+  outToken.mLength = (size_t)(position - stream);
+  if (acceptedToken != 0)
+  {
+    outToken.mTokenType = acceptedToken;
+    outToken.mLength = (size_t)(accepted - stream);
+  }
+}
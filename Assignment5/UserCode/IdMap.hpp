@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// A flat open addressed hash map from nonzero integer ids (atoms, pointers, ...) to small values
+// Lookups hash one integer and compare integers, with the keys and values side by side in one array
+template <typename Value>
+class IdMap
+{
+public:
+  // Returns false (leaving the existing value alone) if the id is already in the map
+  bool Insert(uint64_t id, const Value& value)
+  {
+    if ((mCount + 1) * 2 > mEntries.size())
+      Grow();
+
+    Entry& entry = mEntries[FindSlot(id)];
+    if (entry.mId == id)
+      return false;
+    entry.mId = id;
+    entry.mValue = value;
+    ++mCount;
+    return true;
+  }
+
+  // Returns null if the id is not in the map
+  Value* Find(uint64_t id)
+  {
+    if (mCount == 0)
+      return nullptr;
+    Entry& entry = mEntries[FindSlot(id)];
+    return entry.mId == id ? &entry.mValue : nullptr;
+  }
+
+  size_t GetCount() const
+  {
+    return mCount;
+  }
+
+private:
+  class Entry
+  {
+  public:
+    uint64_t mId = 0;
+    Value mValue = Value();
+  };
+
+  size_t FindSlot(uint64_t id) const
+  {
+    // Fibonacci hashing spreads sequential atoms and aligned pointers alike
+    size_t mask = mEntries.size() - 1;
+    size_t slot = (size_t)((id * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+    while (mEntries[slot].mId != 0 && mEntries[slot].mId != id)
+      slot = (slot + 1) & mask;
+    return slot;
+  }
+
+  void Grow()
+  {
+    std::vector<Entry> entries(mEntries.empty() ? 16 : mEntries.size() * 2);
+    entries.swap(mEntries);
+    for (Entry& entry : entries)
+    {
+      if (entry.mId != 0)
+        mEntries[FindSlot(entry.mId)] = entry;
+    }
+  }
+
+  std::vector<Entry> mEntries;
+  size_t mCount = 0;
+};
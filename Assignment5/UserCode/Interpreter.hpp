@@ -172,7 +172,6 @@ public:
 
   virtual VisitResult Visit(NameReferenceNode* node) override
   {
-    const std::string& name = node->mName.str();
     Function* function = dynamic_cast<Function*>(node->mSymbol);
 
     // Find a variable, first checking the function locals then the glboals
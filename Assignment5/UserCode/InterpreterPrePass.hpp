@@ -2,13 +2,15 @@
 
 #include "Visitor.hpp"
 #include "../Drivers/Driver4.hpp"
+#include "Literals.hpp"
 
 class InterpreterPrePassVisitor : public Visitor
 {
 public:
-  InterpreterPrePassVisitor(FunctionCallback fnCallback)
+  InterpreterPrePassVisitor(FunctionCallback fnCallback, ConstantPool* constants)
   {
     mFnCallback = fnCallback;
+    mConstants = constants;
   }
 
   virtual VisitResult Visit(FunctionNode* node) override
@@ -18,46 +20,19 @@ public:
     return VisitResult::Continue;
   }
 
-  static std::string ParseLiteral(const std::string& str)
-  {
-    std::string result;
-    for (size_t i = 1; i < str.size() - 1; ++i)
-    {
-      char byte = 0;
-      if (str[i] == '\\')
-      {
-        ++i;
-        if (str[i] == 'r')
-          byte = '\r';
-        else if (str[i] == 'n')
-          byte = '\n';
-        else if (str[i] == 't')
-          byte = '\t';
-        else if (str[i] == '\"')
-          byte = '\'';
-        else if (str[i] == '\"')
-          byte = '\"';
-      }
-      else
-        byte = str[i];
-      result.push_back(byte);
-    }
-    return result;
-  }
-
   virtual VisitResult Visit(LiteralNode* node) override
   {
-    const std::string& str = node->mToken.str();
+    // Numbers and characters were decoded by the scanner, and strings go in the tree's pool (the scanner has nowhere to keep a string)
     Variant variant;
     if (node->mToken.mEnumTokenType == TokenType::IntegerLiteral)
     {
       variant.mType = IntegerType;
-      variant.mValue.mInteger = atoi(str.c_str());
+      variant.mValue.mInteger = GetIntegerLiteralValue(node->mToken);
     }
     else if (node->mToken.mEnumTokenType == TokenType::FloatLiteral)
     {
       variant.mType = FloatType;
-      variant.mValue.mFloat = (float)atof(str.c_str());
+      variant.mValue.mFloat = GetFloatLiteralValue(node->mToken);
     }
     else if (node->mToken.mEnumTokenType == TokenType::True)
     {
@@ -70,18 +45,18 @@ public:
       variant.mValue.mBoolean = false;
     }
     else if (node->mToken.mEnumTokenType == TokenType::Null)
-      node->mResolvedType = mLibrary->GetPointerType(NullType);
+    {
+      // The expression resolver already gave it the Null pointer type
+    }
     else if (node->mToken.mEnumTokenType == TokenType::CharacterLiteral)
     {
       variant.mType = ByteType;
-      node->mString = ParseLiteral(str);
-      variant.mValue.mByte = node->mString[0];
+      variant.mValue.mByte = GetCharacterLiteralValue(node->mToken);
     }
     else if (node->mToken.mEnumTokenType == TokenType::StringLiteral)
     {
       variant.mType = BytePointerType;
-      node->mString = ParseLiteral(str);
-      variant.mValue.mPointer = &node->mString[0];
+      variant.mValue.mPointer = const_cast<char*>(mConstants->AddLiteral(node->mToken).data());
     }
     else
     {
@@ -92,5 +67,5 @@ public:
   }
 
   FunctionCallback mFnCallback = nullptr;
-  Library* mLibrary = nullptr;
+  ConstantPool* mConstants = nullptr;
 };
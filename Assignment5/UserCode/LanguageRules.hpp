@@ -0,0 +1,282 @@
+#pragma once
+
+#include "../Drivers/Driver1.hpp"
+#include "Dfa.hpp"
+
+// The rules for the language DFA are written once against a 'Builder' so that the same rules
+// can build a DfaState graph at runtime (DfaGraphBuilder) or a constant table at compile time (StaticDfaBuilder)
+// A Builder provides:
+//   State                                      A handle to a state, where State() means 'no state'
+//   State AddState(int acceptingToken)
+//   void AddEdge(State from, State to, char c)
+//   void AddDefaultEdge(State from, State to)
+//   State Find(State state, char c)            The edge taken on c, falling back to the default edge
+//   State FindEdge(State state, char c)        Only the edge added for exactly c
+//   void CopyEdges(State to, State from)       Replaces all of the edges of 'to' with the edges of 'from'
+//   void SetAcceptingToken(State state, int acceptingToken)
+
+// Builds the DfaState graph through the regular AddState / AddEdge / AddDefaultEdge functions
+class DfaGraphBuilder
+{
+public:
+  typedef DfaState* State;
+
+  State AddState(int acceptingToken)
+  {
+    return ::AddState(acceptingToken);
+  }
+
+  void AddEdge(State from, State to, char c)
+  {
+    ::AddEdge(from, to, c);
+  }
+
+  void AddDefaultEdge(State from, State to)
+  {
+    ::AddDefaultEdge(from, to);
+  }
+
+  State Find(State state, char c)
+  {
+    return state->Find(c);
+  }
+
+  State FindEdge(State state, char c)
+  {
+    auto it = state->mEdges.find(c);
+    if (it == state->mEdges.end())
+      return nullptr;
+    return it->second;
+  }
+
+  void CopyEdges(State to, State from)
+  {
+    to->mEdges = from->mEdges;
+  }
+
+  void SetAcceptingToken(State state, int acceptingToken)
+  {
+    state->mAcceptingToken = acceptingToken;
+  }
+};
+
+template <typename Builder>
+constexpr void CreateRuleWhitespace(Builder& builder, typename Builder::State root)
+{
+  const char values[] = { ' ', '\r', '\n', '\t' };
+  auto state = builder.AddState(TokenType::Whitespace);
+  for (size_t i = 0; i < sizeof(values); ++i)
+  {
+    builder.AddEdge(root, state, values[i]);
+    builder.AddEdge(state, state, values[i]);
+  }
+}
+
+template <typename Builder>
+constexpr typename Builder::State CreateRuleIdentifier(Builder& builder, typename Builder::State root)
+{
+  auto state = builder.AddState(TokenType::Identifier);
+  for (char value = 'a'; value <= 'z'; ++value)
+  {
+    builder.AddEdge(root, state, value);
+    builder.AddEdge(state, state, value);
+  }
+  for (char value = 'A'; value <= 'Z'; ++value)
+  {
+    builder.AddEdge(root, state, value);
+    builder.AddEdge(state, state, value);
+  }
+  builder.AddEdge(root, state, '_');
+  builder.AddEdge(state, state, '_');
+  for (char value = '0'; value <= '9'; ++value)
+    builder.AddEdge(state, state, value);
+  return state;
+}
+
+template <typename Builder>
+constexpr void BuildKeywordRule(Builder& builder, typename Builder::State root, typename Builder::State identifierState,
+  TokenType::Enum tokenType, const char* str)
+{
+  auto state = root;
+  for (; *str != '\0'; ++str)
+  {
+    auto nextState = builder.FindEdge(state, *str);
+    if (nextState == typename Builder::State() || nextState == identifierState)
+    {
+      // Each prefix of a keyword is still an identifier, and any character that
+      // doesn't continue a keyword falls back into the regular identifier state
+      nextState = builder.AddState(TokenType::Identifier);
+      builder.CopyEdges(nextState, identifierState);
+      builder.AddEdge(state, nextState, *str);
+    }
+    state = nextState;
+  }
+  builder.SetAcceptingToken(state, tokenType);
+}
+
+// Builds a trie of all the keywords on top of the identifier rule so that keywords
+// are recognized in the same pass as identifiers (no string building or lookup afterwards)
+// The trie is most of the table: 524 states x 59 classes (about 69KB with the accepting tokens and loops) against
+// 69 x 36 (6KB) without keywords, so the whole table no longer fits in L1. Scanning real code touches about half the
+// rows, and an identifier-only table followed by a perfect hash of the keywords was measured at 2-7% faster, but it
+// would need a lookup step in every tokenizer (tables, generated scanner, chunked, linear and incremental)
+template <typename Builder>
+constexpr void CreateRuleKeywords(Builder& builder, typename Builder::State root, typename Builder::State identifierState)
+{
+#define TOKEN(Name, Value) BuildKeywordRule(builder, root, identifierState, TokenType::Name, Value);
+#include "../Drivers/TokenKeywords.inl"
+#undef TOKEN
+}
+
+template <typename Builder>
+constexpr typename Builder::State CreateIntRule(Builder& builder, typename Builder::State root)
+{
+  auto intState = builder.AddState(TokenType::IntegerLiteral);
+  for (char value = '0'; value <= '9'; ++value)
+  {
+    builder.AddEdge(root, intState, value);
+    builder.AddEdge(intState, intState, value);
+  }
+  return intState;
+}
+
+template <typename Builder>
+constexpr typename Builder::State CreateFloatRule(Builder& builder, typename Builder::State intState)
+{
+  auto dotState = builder.AddState(0);
+  auto eState = builder.AddState(0);
+  auto signState = builder.AddState(0);
+  auto floatState0 = builder.AddState(TokenType::FloatLiteral);
+  auto floatState1 = builder.AddState(TokenType::FloatLiteral);
+  auto floatState2 = builder.AddState(TokenType::FloatLiteral);
+
+  builder.AddEdge(intState, dotState, '.');
+  for (char value = '0'; value <= '9'; ++value)
+  {
+    builder.AddEdge(dotState, floatState0, value);
+    builder.AddEdge(floatState0, floatState0, value);
+  }
+
+  builder.AddEdge(floatState0, eState, 'e');
+  builder.AddEdge(eState, signState, '+');
+  builder.AddEdge(eState, signState, '-');
+  for (char value = '0'; value <= '9'; ++value)
+  {
+    builder.AddEdge(eState, floatState1, value);
+    builder.AddEdge(signState, floatState1, value);
+    builder.AddEdge(floatState1, floatState1, value);
+  }
+  builder.AddEdge(floatState1, floatState2, 'f');
+  builder.AddEdge(floatState0, floatState2, 'f');
+  return floatState2;
+}
+
+template <typename Builder>
+constexpr void BuildTokenRule(Builder& builder, typename Builder::State root, TokenType::Enum tokenType, const char* str)
+{
+  auto state = root;
+  while (str != nullptr && *str != '\0')
+  {
+    char value = *str;
+    auto nextState = builder.Find(state, value);
+    if (nextState == typename Builder::State())
+    {
+      nextState = builder.AddState(0);
+      builder.AddEdge(state, nextState, value);
+    }
+    state = nextState;
+    ++str;
+  }
+  builder.SetAcceptingToken(state, tokenType);
+}
+
+template <typename Builder>
+constexpr void BuildTokenRules(Builder& builder, typename Builder::State root)
+{
+#define TOKEN(Name, Value) BuildTokenRule(builder, root, TokenType::Name, Value);
+#include "../Drivers/TokenSymbols.inl"
+#undef TOKEN
+}
+
+template <typename Builder>
+constexpr typename Builder::State StringLiteralRule(Builder& builder, typename Builder::State root, TokenType::Enum tokenType, char delimiterChar)
+{
+  auto begin = builder.AddState(0);
+  auto charState = builder.AddState(0);
+  auto startEscapeState = builder.AddState(0);
+  auto end = builder.AddState(tokenType);
+  builder.AddEdge(root, begin, delimiterChar);
+  builder.AddDefaultEdge(begin, charState);
+  builder.AddDefaultEdge(charState, charState);
+  builder.AddEdge(charState, startEscapeState, '\\');
+  builder.AddEdge(startEscapeState, charState, 'n');
+  builder.AddEdge(startEscapeState, charState, 'r');
+  builder.AddEdge(startEscapeState, charState, 't');
+  builder.AddEdge(startEscapeState, charState, delimiterChar);
+  builder.AddEdge(charState, end, delimiterChar);
+  return end;
+}
+
+template <typename Builder>
+constexpr typename Builder::State StringLiteralRule(Builder& builder, typename Builder::State root)
+{
+  return StringLiteralRule(builder, root, TokenType::StringLiteral, '\"');
+}
+
+template <typename Builder>
+constexpr void CommentRule(Builder& builder, typename Builder::State root)
+{
+  auto firstSlash = builder.Find(root, '/');
+  auto singleCommentBody = builder.AddState(0);
+  auto singleCommentEnd = builder.AddState(TokenType::SingleLineComment);
+  auto multiCommentBody = builder.AddState(0);
+  auto multiCommentStar = builder.AddState(0);
+  auto multiCommentEnd = builder.AddState(TokenType::MultiLineComment);
+
+  builder.AddEdge(root, firstSlash, '/');
+
+  builder.AddEdge(firstSlash, singleCommentBody, '/');
+  builder.AddDefaultEdge(singleCommentBody, singleCommentBody);
+  builder.AddEdge(singleCommentBody, singleCommentEnd, '\r');
+  builder.AddEdge(singleCommentBody, singleCommentEnd, '\n');
+  builder.AddEdge(singleCommentBody, singleCommentEnd, '\0');
+
+  builder.AddEdge(firstSlash, multiCommentBody, '*');
+  builder.AddDefaultEdge(multiCommentBody, multiCommentBody);
+  builder.AddEdge(multiCommentBody, multiCommentStar, '*');
+  builder.AddDefaultEdge(multiCommentStar, multiCommentBody);
+  builder.AddEdge(multiCommentStar, multiCommentEnd, '/');
+}
+
+template <typename Builder>
+constexpr typename Builder::State CharLiteralRule(Builder& builder, typename Builder::State root)
+{
+  auto begin = builder.AddState(0);
+  auto charState = builder.AddState(0);
+  auto end = builder.AddState(TokenType::CharacterLiteral);
+  builder.AddEdge(root, begin, '\'');
+  builder.AddDefaultEdge(begin, charState);
+  builder.AddDefaultEdge(charState, charState);
+  builder.AddEdge(charState, end, '\'');
+  return end;
+}
+
+// Adds every rule of the language to the given root
+template <typename Builder>
+constexpr void BuildLanguageRules(Builder& builder, typename Builder::State root)
+{
+  CreateRuleWhitespace(builder, root);
+  auto identifierRule = CreateRuleIdentifier(builder, root);
+  CreateRuleKeywords(builder, root, identifierRule);
+  auto intRule = CreateIntRule(builder, root);
+  CreateFloatRule(builder, intRule);
+  BuildTokenRules(builder, root);
+  StringLiteralRule(builder, root);
+  CharLiteralRule(builder, root);
+  CommentRule(builder, root);
+}
+
+// Builds the language as a DfaState graph at runtime (minimized and compiled)
+// Useful for tools that want to inspect or transform the graph, CreateLanguageDfa uses the static table instead
+// The report of the minimization is stored in reportOut when one is given
+DfaState* BuildLanguageDfa(DfaMinimizeReport* reportOut = nullptr);
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "../Drivers/Driver1.hpp"
+#include "Dfa.hpp"
+#include "StaticDfa.hpp"
+#include "Tokenizer.hpp"
+
+#include <vector>
+
+// The root that CreateLanguageDfa hands out: one state for the whole process over the static language table
+// It is read only (ReadLanguageToken, TokenStream, ...) and DeleteStateAndChildren leaves it alone
+DfaState* GetLanguageRoot();
+
+// Fills in what the language scanner records beyond the text and type (see Token::mAtom): identifiers get the atom of
+// their interned name, and integer, float and character literals their value. Every language token that reaches the
+// parser goes through here once, when it is scanned
+void AnnotateLanguageToken(Token& token);
+void AnnotateLanguageTokens(std::vector<Token>& tokens, size_t begin = 0);
+
+// The language scanner, built once at compile time and shared by the whole process
+// Nothing in it changes after construction and every member is const, so any number of threads can scan with
+// the same instance at once without locks. It lives (in read-only memory) until the process exits, so a long running
+// process can keep using it for every compile instead of building a DFA each time
+class LanguageScanner
+{
+public:
+  static const LanguageScanner& GetInstance()
+  {
+    static const LanguageScanner scanner(GetStaticLanguageTable());
+    return scanner;
+  }
+
+  explicit LanguageScanner(const DfaTable& table) :
+    mTable(table)
+  {
+  }
+
+  const DfaTable& GetTable() const
+  {
+    return mTable;
+  }
+
+  void ReadToken(const char* stream, Token& outToken) const
+  {
+    ReadTableToken(mTable, stream, outToken);
+    AnnotateLanguageToken(outToken);
+  }
+
+  void Tokenize(const char* stream, std::vector<Token>& tokensOut) const
+  {
+    size_t begin = tokensOut.size();
+    TokenizeStream(mTable, stream, tokensOut);
+    AnnotateLanguageTokens(tokensOut, begin);
+  }
+
+  void TokenizeSkippingTrivia(const char* stream, std::vector<Token>& tokensOut, std::vector<Token>* triviaOut = nullptr) const
+  {
+    size_t begin = tokensOut.size();
+    TokenizeStreamSkippingTrivia(mTable, stream, tokensOut, triviaOut);
+    AnnotateLanguageTokens(tokensOut, begin);
+  }
+
+private:
+  const DfaTable& mTable;
+};
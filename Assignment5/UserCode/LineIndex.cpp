@@ -0,0 +1,90 @@
+/******************************************************************\
+ * Author:
+ * Copyright 2015, DigiPen Institute of Technology
+\******************************************************************/
+#include "LineIndex.hpp"
+
+#include <algorithm>
+#include "Simd.hpp"
+
+std::string SourceLocation::str() const
+{
+  return std::to_string(mLine) + ":" + std::to_string(mColumn);
+}
+
+SourceLocation LineIndex::GetLocation(size_t offset) const
+{
+  Build();
+  // The last line that starts at or before the offset
+  auto it = std::upper_bound(mLineStarts.begin(), mLineStarts.end(), offset) - 1;
+  SourceLocation location;
+  location.mLine = (size_t)(it - mLineStarts.begin()) + 1;
+  location.mColumn = offset - *it + 1;
+  return location;
+}
+
+void LineIndex::Build() const
+{
+  if (mBuilt)
+    return;
+  mBuilt = true;
+  mLineStarts.push_back(0);
+
+  size_t index = 0;
+#if SIMD_AVX2 || SIMD_SSE2
+#if SIMD_AVX2
+  typedef __m256i Vector;
+  const size_t cVectorSize = 32;
+#else
+  typedef __m128i Vector;
+  const size_t cVectorSize = 16;
+#endif
+
+  // Aligned loads never cross into a page past the null terminator
+  while (((uintptr_t)(mText + index) & (cVectorSize - 1)) != 0)
+  {
+    char value = mText[index];
+    if (value == '\0')
+      return;
+    ++index;
+    if (value == '\n')
+      mLineStarts.push_back(index);
+  }
+
+#if SIMD_AVX2
+  Vector newlines = _mm256_set1_epi8('\n');
+  Vector terminators = _mm256_setzero_si256();
+#else
+  Vector newlines = _mm_set1_epi8('\n');
+  Vector terminators = _mm_setzero_si128();
+#endif
+  for (;; index += cVectorSize)
+  {
+#if SIMD_AVX2
+    Vector bytes = _mm256_load_si256((const Vector*)(mText + index));
+    uint32_t newlineMask = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, newlines));
+    uint32_t endMask = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, terminators));
+#else
+    Vector bytes = _mm_load_si128((const Vector*)(mText + index));
+    uint32_t newlineMask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, newlines));
+    uint32_t endMask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, terminators));
+#endif
+    // Only newlines before the terminator belong to the text
+    if (endMask != 0)
+      newlineMask &= (1u << CountTrailingZeros(endMask)) - 1;
+    while (newlineMask != 0)
+    {
+      mLineStarts.push_back(index + CountTrailingZeros(newlineMask) + 1);
+      newlineMask &= newlineMask - 1;
+    }
+    if (endMask != 0)
+      return;
+  }
+#else
+  for (; mText[index] != '\0'; ++index)
+  {
+    if (mText[index] == '\n')
+      mLineStarts.push_back(index + 1);
+  }
+#endif
+}
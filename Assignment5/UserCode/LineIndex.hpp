@@ -0,0 +1,52 @@
+#pragma once
+
+#include "../Drivers/Driver1.hpp"
+
+#include <string>
+#include <vector>
+
+// A 1-based line and column (columns count bytes, so a tab is one column)
+class SourceLocation
+{
+public:
+  size_t mLine = 0;
+  size_t mColumn = 0;
+
+  // "line:column"
+  std::string str() const;
+};
+
+// Maps offsets (or tokens) in a source text to lines and columns
+// Nothing is done until the first location is asked for, so scanning and parsing never pay for line tracking.
+// The first request finds every newline in one vector pass, after which each lookup is a binary search
+// The text must outlive the index. Building is lazy, so an index should not be shared between threads
+class LineIndex
+{
+public:
+  explicit LineIndex(const char* text) :
+    mText(text)
+  {
+  }
+
+  SourceLocation GetLocation(size_t offset) const;
+
+  // The token must point into the indexed text
+  SourceLocation GetLocation(const Token& token) const
+  {
+    return GetLocation((size_t)(token.mText - mText));
+  }
+
+  size_t GetLineCount() const
+  {
+    Build();
+    return mLineStarts.size();
+  }
+
+private:
+  void Build() const;
+
+  const char* mText;
+  // The offset of the first character of every line
+  mutable std::vector<size_t> mLineStarts;
+  mutable bool mBuilt = false;
+};
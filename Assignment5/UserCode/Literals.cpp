@@ -0,0 +1,87 @@
+/******************************************************************\
+ * Author:
+ * Copyright 2015, DigiPen Institute of Technology
+\******************************************************************/
+#include "Literals.hpp"
+
+#include <charconv>
+#include <climits>
+#include <stdlib.h>
+#include <string.h>
+
+int DecodeIntegerLiteral(const Token& token)
+{
+  // atoi is (int)strtol, which clamps to the range of a long before narrowing
+  long value = 0;
+  std::from_chars_result result = std::from_chars(token.mText, token.mText + token.mLength, value);
+  if (result.ec == std::errc::result_out_of_range)
+    value = LONG_MAX;
+  return (int)value;
+}
+
+float DecodeFloatLiteral(const Token& token)
+{
+  // Parsing to a double first rounds exactly like atof does before the narrowing (the trailing 'f' just ends the number)
+  double value = 0.0;
+  std::from_chars_result result = std::from_chars(token.mText, token.mText + token.mLength, value);
+  // from_chars leaves the value alone when it overflows or underflows, strtod saturates
+  if (result.ec == std::errc::result_out_of_range)
+    value = strtod(token.mText, nullptr);
+  return (float)value;
+}
+
+// Decodes the character at the index of a quoted literal (moving past its escape), the index must be before the closing quote
+static char DecodeQuotedCharacter(const Token& token, size_t& i)
+{
+  char value = token.mText[i];
+  if (value == '\\' && i + 2 < token.mLength)
+  {
+    value = token.mText[++i];
+    if (value == 'n')
+      value = '\n';
+    else if (value == 'r')
+      value = '\r';
+    else if (value == 't')
+      value = '\t';
+  }
+  return value;
+}
+
+char DecodeCharacterLiteral(const Token& token)
+{
+  // Skip the opening quote
+  size_t i = 1;
+  return i + 1 < token.mLength ? DecodeQuotedCharacter(token, i) : '\0';
+}
+
+std::string_view ConstantPool::AddLiteral(const Token& token)
+{
+  mDecoded.clear();
+  // Skip the quotes
+  for (size_t i = 1; i + 1 < token.mLength; ++i)
+    mDecoded.push_back(DecodeQuotedCharacter(token, i));
+  return Add(mDecoded.data(), mDecoded.size());
+}
+
+std::string_view ConstantPool::Add(const char* text, size_t length)
+{
+  auto it = mStrings.find(std::string_view(text, length));
+  if (it != mStrings.end())
+    return *it;
+
+  // Long strings get a block of their own
+  if (mBlocks.empty() || mBlockSize - mBlockUsed < length + 1)
+  {
+    mBlockSize = length + 1 > cBlockSize ? length + 1 : cBlockSize;
+    mBlocks.emplace_back(new char[mBlockSize]);
+    mBlockUsed = 0;
+  }
+  char* copy = mBlocks.back().get() + mBlockUsed;
+  memcpy(copy, text, length);
+  copy[length] = '\0';
+  mBlockUsed += length + 1;
+
+  std::string_view pooled(copy, length);
+  mStrings.insert(pooled);
+  return pooled;
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "../Drivers/Driver1.hpp"
+
+#include <memory>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+// Decoding of literal tokens straight from the source text (no strings are built along the way)
+
+// The value of an IntegerLiteral token, the same as atoi gives (including for values that don't fit)
+int DecodeIntegerLiteral(const Token& token);
+
+// The value of a FloatLiteral token, the same as (float)atof gives
+float DecodeFloatLiteral(const Token& token);
+
+// The byte a CharacterLiteral token stands for, with its escape decoded (0 for an empty literal)
+char DecodeCharacterLiteral(const Token& token);
+
+// The value the language scanner stored on the token (see Token::mIntegerValue), decoding it for any other token
+inline int GetIntegerLiteralValue(const Token& token)
+{
+  return token.mIntegerValue != 0 ? token.mIntegerValue : DecodeIntegerLiteral(token);
+}
+
+inline float GetFloatLiteralValue(const Token& token)
+{
+  return token.mFloatValue != 0.0f ? token.mFloatValue : DecodeFloatLiteral(token);
+}
+
+inline char GetCharacterLiteralValue(const Token& token)
+{
+  return token.mIntegerValue != 0 ? (char)token.mIntegerValue : DecodeCharacterLiteral(token);
+}
+
+// The decoded string literals of one compilation, each distinct value stored once and null terminated
+// The root BlockNode of every tree owns one (see InterpreterPrePass), so compilations never share it. Pooled strings
+// never move and live as long as the tree, so any number of literal nodes can point at them
+// Like string literals in C they must not be written to. Not thread safe (a compilation runs on one thread)
+class ConstantPool
+{
+public:
+  // Decodes the escapes (\n, \r, \t, \" and \') of a StringLiteral or CharacterLiteral token, without its quotes
+  std::string_view AddLiteral(const Token& token);
+
+  // Returns the pooled, null terminated copy of the text
+  std::string_view Add(const char* text, size_t length);
+
+private:
+  static const size_t cBlockSize = 16 * 1024;
+
+  std::unordered_set<std::string_view> mStrings;
+  // Allocated in blocks so the strings never move
+  std::vector<std::unique_ptr<char[]>> mBlocks;
+  size_t mBlockUsed = 0;
+  size_t mBlockSize = 0;
+  // Scratch space for decoding
+  std::vector<char> mDecoded;
+};
@@ -3,14 +3,16 @@
 #include "Visitor.hpp"
 #include "../Drivers/Driver4.hpp"
 #include "LibraryHelpers.hpp"
+#include "SymbolIndex.hpp"
 
 class MemberResolverVisitor : public Visitor
 {
 public:
   
-  MemberResolverVisitor(Library* library)
+  MemberResolverVisitor(Library* library, SymbolIndex* symbolIndex)
   {
     mLibrary = library;
+    mSymbolIndex = symbolIndex;
   }
 
   virtual VisitResult Visit(BlockNode* node)
@@ -51,7 +53,7 @@ public:
     else if(mClass != nullptr)
     {
       variableSymbol->mParentType = mClass->mSymbol;
-      if (mClass->mSymbol->mMembersByName.find(variableSymbol->mName) != mClass->mSymbol->mMembersByName.end())
+      if (!mSymbolIndex->AddMember(mClass->mSymbol, variableSymbol))
         ErrorSameName(variableSymbol->mName);
       mClass->mSymbol->mMembers.push_back(variableSymbol);
       mClass->mSymbol->mMembersByName.insert(std::make_pair(variableSymbol->mName, variableSymbol));
@@ -77,6 +79,7 @@ public:
     if (mClass != nullptr)
     {
       functionSymbol->mParentType = mClass->mSymbol;
+      mSymbolIndex->AddMember(mClass->mSymbol, functionSymbol);
       mClass->mSymbol->mMembers.push_back(functionSymbol);
       mClass->mSymbol->mMembersByName.insert(std::make_pair(name, functionSymbol));
     }
@@ -108,6 +111,7 @@ public:
   }
 
   Library* mLibrary = nullptr;
+  SymbolIndex* mSymbolIndex = nullptr;
   BlockNode* mBlock = nullptr;
   ClassNode* mClass = nullptr;
   FunctionNode* mFunction = nullptr;
@@ -3,26 +3,167 @@
 #include "../Drivers/Driver3.hpp"
 
 #include "../Drivers/AstNodes.hpp"
+#include "LanguageScanner.hpp"
+#include "LineIndex.hpp"
+#include "SourceFile.hpp"
+#include "Tracing.hpp"
+#include "TokenBuffer.hpp"
+#include "TokenStream.hpp"
+
+// Traces every rule and accepted token to the diagnostic sink (the output the driver tests expect)
+class TracingParserPolicy
+{
+public:
+  typedef RuleTrace Rule;
+  // The trace shows every level of the expression grammar, so expressions are parsed rule by rule
+  static const bool cClimbExpressions = false;
+
+  static void AcceptedToken(const Token& token)
+  {
+    RuleTrace::AcceptedToken(token);
+  }
+};
+
+// Compiles the tracing away: rules are empty objects and accepting a token does nothing extra
+class SilentParserPolicy
+{
+public:
+  class Rule
+  {
+  public:
+    explicit Rule(const char*)
+    {
+    }
+
+    template <typename T>
+    T Accept(T result)
+    {
+      return result;
+    }
+
+    bool Accept()
+    {
+      return true;
+    }
+  };
+
+  static void AcceptedToken(const Token&)
+  {
+  }
+
+  // Nothing shows the rules, so expressions are parsed by precedence climbing (see BasicParser::ClimbExpression)
+  static const bool cClimbExpressions = true;
+};
+
+// The binding power of every operator in the expression grammar (Expression to Expression6 in Grammar.txt)
+// A binary precedence of 0 means the token isn't a binary operator. Assignments are the only right to left binary operators
+class ExpressionOperatorTable
+{
+public:
+  static const uint8_t cAssignmentPrecedence = 1;
+
+  constexpr ExpressionOperatorTable() :
+    mBinaryPrecedence(),
+    mIsUnary()
+  {
+    const int cLevels[][6] =
+    {
+      { TokenType::Assignment, TokenType::AssignmentPlus, TokenType::AssignmentMinus,
+        TokenType::AssignmentMultiply, TokenType::AssignmentDivide, TokenType::AssignmentModulo },
+      { TokenType::LogicalOr },
+      { TokenType::LogicalAnd },
+      { TokenType::LessThan, TokenType::GreaterThan, TokenType::LessThanOrEqualTo,
+        TokenType::GreaterThanOrEqualTo, TokenType::Equality, TokenType::Inequality },
+      { TokenType::Plus, TokenType::Minus },
+      { TokenType::Asterisk, TokenType::Divide, TokenType::Modulo },
+    };
+    for (size_t level = 0; level < 6; ++level)
+    {
+      for (int tokenType : cLevels[level])
+      {
+        // Unused entries are 0 (Invalid)
+        if (tokenType != 0)
+          mBinaryPrecedence[tokenType] = (uint8_t)(level + 1);
+      }
+    }
+
+    const int cUnary[] = { TokenType::Asterisk, TokenType::Ampersand, TokenType::Plus, TokenType::Minus,
+      TokenType::LogicalNot, TokenType::Increment, TokenType::Decrement };
+    for (int tokenType : cUnary)
+      mIsUnary[tokenType] = true;
+  }
+
+  uint8_t mBinaryPrecedence[TokenType::EnumCount];
+  bool mIsUnary[TokenType::EnumCount];
+};
 
-class Parser
+static constexpr ExpressionOperatorTable cExpressionOperators;
+
+// The driver builds trace every parse, every other build parses silently
+#if DRIVER1 || DRIVER2 || DRIVER3 || DRIVER4 || DRIVER5
+typedef TracingParserPolicy DefaultParserPolicy;
+#else
+typedef SilentParserPolicy DefaultParserPolicy;
+#endif
+
+template <typename Policy>
+class BasicParser
 {
 public:
-  void Load(std::vector<Token>& tokens)
+  // Parses the tokens in place (nothing is copied), so they must outlive the parse
+  void Load(const Token* tokens, size_t count)
   {
     mTokens = tokens;
+    mTokenCount = count;
     mTokenIndex = 0;
+    mStream = nullptr;
+    mBuffer = nullptr;
+  }
+
+  void Load(const std::vector<Token>& tokens)
+  {
+    Load(tokens.data(), tokens.size());
+  }
+
+  // Pulls tokens from the stream as they are needed instead of reading them all up front
+  // The stream must outlive the parse
+  void Load(TokenStream& stream)
+  {
+    mTokens = nullptr;
+    mTokenCount = 0;
+    mTokenIndex = 0;
+    mStream = &stream;
+    mBuffer = nullptr;
+  }
+
+  // Reads tokens straight out of the buffer (only the accepted ones are rebuilt into a Token)
+  // The buffer should not contain whitespace or comments, and must outlive the parse
+  void Load(const TokenBuffer& buffer)
+  {
+    mTokens = nullptr;
+    mTokenCount = 0;
+    mTokenIndex = 0;
+    mStream = nullptr;
+    mBuffer = &buffer;
+  }
+
+  // When set, a parsing failure reports the line and column of the token it stopped at
+  // The index is only consulted once parsing has already failed, so it costs nothing on success
+  void SetLineIndex(const LineIndex* lineIndex)
+  {
+    mLineIndex = lineIndex;
   }
 
   void ReadTokens()
   {
     Block();
-    Expect(mTokenIndex == mTokens.size());
+    Expect(!HasToken());
   }
 
   std::unique_ptr<BlockNode> Block()
   {
     //Block               = (Class | Function | Var <Semicolon>)*
-    PrintRule rule("Block");
+    typename Policy::Rule rule("Block");
     auto&& result = std::make_unique<BlockNode>();
 
     while (true)
@@ -45,7 +186,7 @@ public:
   std::unique_ptr<ClassNode> Class()
   {
     //Class               = <Class> <Identifier> <OpenCurley> (Var <Semicolon> | Function)* <CloseCurley>
-    PrintRule rule("Class");
+    typename Policy::Rule rule("Class");
     if (this->Accept(TokenType::Class) == false)
       return nullptr;
 
@@ -73,7 +214,7 @@ public:
   std::unique_ptr<VariableNode> Var()
   {
     //Var                 = <Var> <Identifier> SpecifiedType (<Assignment> Expression)?
-    PrintRule rule("Var");
+    typename Policy::Rule rule("Var");
     if (!Accept(TokenType::Var))
       return nullptr;
 
@@ -95,7 +236,7 @@ public:
   std::unique_ptr<FunctionNode> Function()
   {
     //Function            = <Function> <Identifier> <OpenPareantheses> (Parameter (<Comma> Parameter)*)? <CloseParentheses> SpecifiedType? Scope
-    PrintRule rule("Function");
+    typename Policy::Rule rule("Function");
     if (!Accept(TokenType::Function))
       return nullptr;
 
@@ -128,7 +269,7 @@ public:
   std::unique_ptr<ParameterNode> Parameter()
   {
     //Parameter           = <Identifier> SpecifiedType
-    PrintRule rule("Parameter");
+    typename Policy::Rule rule("Parameter");
     Token name;
     if (!Accept(TokenType::Identifier, &name))
       return nullptr;
@@ -139,7 +280,7 @@ public:
     return rule.Accept(std::move(result));
   }
 
-  template <typename T, std::unique_ptr<T>(Parser::* Fn)()>
+  template <typename T, std::unique_ptr<T>(BasicParser::* Fn)()>
   bool GetNode(std::unique_ptr<T>& result)
   {
     result = (this->*Fn)();
@@ -155,7 +296,7 @@ public:
   std::unique_ptr<TypeNode> SpecifiedType()
   {
     //<Colon> Type
-    PrintRule rule("SpecifiedType");
+    typename Policy::Rule rule("SpecifiedType");
     if (!(Accept(TokenType::Colon)))
       return nullptr;
 
@@ -165,7 +306,7 @@ public:
   std::unique_ptr<TypeNode> Type()
   {
     //NamedType | FunctionType
-    PrintRule rule("Type");
+    typename Policy::Rule rule("Type");
 
     if (auto&& result = NamedType())
       return rule.Accept(std::move(result));
@@ -178,7 +319,7 @@ public:
   std::unique_ptr<TypeNode> NamedType()
   {
     //NamedType           = <Identifier> <Asterisk>* <Ampersand>?
-    PrintRule rule("NamedType");
+    typename Policy::Rule rule("NamedType");
     Token token;
     if (!Accept(TokenType::Identifier, &token))
       return nullptr;
@@ -207,7 +348,7 @@ public:
   std::unique_ptr<TypeNode> FunctionType()
   {
     //FunctionType        = <Function> <Asterisk>+ <Ampersand>? <OpenParentheses> Type (<Comma> Type)* <CloseParentheses> SpecifiedType?
-    PrintRule rule("FunctionType");
+    typename Policy::Rule rule("FunctionType");
     if (!Accept(TokenType::Function))
       return nullptr;
 
@@ -252,7 +393,7 @@ public:
   std::unique_ptr<ScopeNode> Scope()
   {
     //Scope               = <OpenCurley> Statement* <CloseCurley>
-    PrintRule rule("Scope");
+    typename Policy::Rule rule("Scope");
     if (!Accept(TokenType::OpenCurley))
       return nullptr;
 
@@ -269,7 +410,7 @@ public:
   std::unique_ptr<StatementNode> Statement()
   {
     //Statement           = FreeStatement | DelimitedStatement <Semicolon>
-    PrintRule rule("Statement");
+    typename Policy::Rule rule("Statement");
     if (auto&& node = FreeStatement())
       return rule.Accept(std::move(node));
     if (auto&& node = DelimitedStatement())
@@ -283,7 +424,7 @@ public:
   std::unique_ptr<StatementNode> DelimitedStatement()
   {
     //DelimitedStatement  = Label | Goto | Return | <Break> | <Continue> | Var | Expression
-    PrintRule rule("DelimitedStatement");
+    typename Policy::Rule rule("DelimitedStatement");
 
     if (auto&& node = Label())
       return rule.Accept(std::move(node));
@@ -306,7 +447,7 @@ public:
   std::unique_ptr<StatementNode> FreeStatement()
   {
     //If | While | For
-    PrintRule rule("FreeStatement");
+    typename Policy::Rule rule("FreeStatement");
 
     if (auto&& node = If())
       return rule.Accept(std::move(node));
@@ -323,7 +464,7 @@ public:
   std::unique_ptr<LabelNode> Label()
   {
     //Label               = <Label> <Identifier>
-    PrintRule rule("Label");
+    typename Policy::Rule rule("Label");
     if (!Accept(TokenType::Label))
       return nullptr;
 
@@ -335,7 +476,7 @@ public:
   std::unique_ptr<GotoNode> Goto()
   {
     //Goto                = <Goto> <Identifier>
-    PrintRule rule("Goto");
+    typename Policy::Rule rule("Goto");
     if (!Accept(TokenType::Goto))
       return nullptr;
 
@@ -347,7 +488,7 @@ public:
   std::unique_ptr<ReturnNode> Return()
   {
     //Return              = <Return> (Expression)?
-    PrintRule rule("Return");
+    typename Policy::Rule rule("Return");
     if (!Accept(TokenType::Return))
       return nullptr;
 
@@ -360,7 +501,7 @@ public:
   std::unique_ptr<IfNode> If()
   {
     //If                  = <If> GroupedExpression Scope Else?
-    PrintRule rule("If");
+    typename Policy::Rule rule("If");
     if (!Accept(TokenType::If))
       return nullptr;
 
@@ -374,7 +515,7 @@ public:
   std::unique_ptr<IfNode> Else()
   {
     //Else                = <Else> (If | Scope)
-    PrintRule rule("Else");
+    typename Policy::Rule rule("Else");
     if (!Accept(TokenType::Else))
       return nullptr;
 
@@ -389,7 +530,7 @@ public:
   std::unique_ptr<WhileNode> While()
   {
     //While               = <While> GroupedExpression Scope
-    PrintRule rule("While");
+    typename Policy::Rule rule("While");
     if (!Accept(TokenType::While))
       return nullptr;
 
@@ -402,7 +543,7 @@ public:
   std::unique_ptr<ForNode> For()
   {
     //For                 = <For> <OpenParentheses> (Var | Expression)? <Semicolon> Expression? <Semicolon> Expression? <CloseParentheses> Scope
-    PrintRule rule("For");
+    typename Policy::Rule rule("For");
     if (!Accept(TokenType::For))
       return nullptr;
 
@@ -427,7 +568,7 @@ public:
   std::unique_ptr<ExpressionNode> GroupedExpression()
   {
     //GroupedExpression   = <OpenParentheses> Expression <CloseParentheses>
-    PrintRule rule("GroupedExpression");
+    typename Policy::Rule rule("GroupedExpression");
     Token token;
     if (!Accept(TokenType::OpenParentheses, &token))
       return nullptr;
@@ -440,7 +581,7 @@ public:
   std::unique_ptr<LiteralNode> Literal()
   {
     //Literal             = <True> | <False> | <Null> | <IntegerLiteral> | <FloatLiteral> | <StringLiteral> | <CharacterLiteral>
-    PrintRule rule("Literal");
+    typename Policy::Rule rule("Literal");
     Token token;
     bool isValid = Accept(TokenType::True, &token) || Accept(TokenType::False, &token) || Accept(TokenType::Null, &token) ||
       Accept(TokenType::IntegerLiteral, &token) || Accept(TokenType::FloatLiteral, &token) ||
@@ -457,7 +598,7 @@ public:
   std::unique_ptr<NameReferenceNode> NameReference()
   {
     //NameReference       = <Identifier>
-    PrintRule rule("NameReference");
+    typename Policy::Rule rule("NameReference");
     Token token;
     if (!Accept(TokenType::Identifier, &token))
       return false;
@@ -470,7 +611,7 @@ public:
   std::unique_ptr<ExpressionNode> Value()
   {
     //Value               = Literal | NameReference | GroupedExpression
-    PrintRule rule("Value");
+    typename Policy::Rule rule("Value");
 
     if (auto&& node = Literal())
       return rule.Accept(std::move(node));
@@ -494,8 +635,11 @@ public:
   // Right to left binary operators (note that Expression recurses into itself and is only optional, this preserves right to left)
   std::unique_ptr<ExpressionNode> Expression()
   {
+    if constexpr (Policy::cClimbExpressions)
+      return ClimbExpression(ExpressionOperatorTable::cAssignmentPrecedence);
+
     //Expression          = Expression1 ((<Assignment> | <AssignmentPlus> | <AssignmentMinus> | <AssignmentMultiply> | <AssignmentDivide> | <AssignmentModulo>) Expression)?
-    PrintRule rule("Expression");
+    typename Policy::Rule rule("Expression");
     auto&& root = Expression1();
     if (!root)
       return nullptr;
@@ -515,7 +659,7 @@ public:
   std::unique_ptr<ExpressionNode> Expression1()
   {
     //Expression1         = Expression2 (<LogicalOr> Expression2)*
-    PrintRule rule("Expression1");
+    typename Policy::Rule rule("Expression1");
     auto&& root = Expression2();
     if (!root)
       return nullptr;
@@ -531,7 +675,7 @@ public:
   std::unique_ptr<ExpressionNode> Expression2()
   {
     //Expression2         = Expression3 (<LogicalAnd> Expression3)*
-    PrintRule rule("Expression2");
+    typename Policy::Rule rule("Expression2");
     auto&& root = Expression3();
     if (!root)
       return nullptr;
@@ -546,7 +690,7 @@ public:
   std::unique_ptr<ExpressionNode> Expression3()
   {
     //Expression3         = Expression4 ((<LessThan> | <GreaterThan> | <LessThanOrEqualTo> | <GreaterThanOrEqualTo> | <Equality> | <Inequality>) Expression4)*
-    PrintRule rule("Expression3");
+    typename Policy::Rule rule("Expression3");
     auto&& root = Expression4();
     if (!root)
       return nullptr;
@@ -564,7 +708,7 @@ public:
   std::unique_ptr<ExpressionNode> Expression4()
   {
     //Expression4         = Expression5 ((<Plus> | <Minus>) Expression5)*
-    PrintRule rule("Expression4");
+    typename Policy::Rule rule("Expression4");
     auto&& root = Expression5();
     if (!root)
       return nullptr;
@@ -580,7 +724,7 @@ public:
   std::unique_ptr<ExpressionNode> Expression5()
   {
     //Expression5         = Expression6 ((<Asterisk> | <Divide> | <Modulo>) Expression6)*
-    PrintRule rule("Expression5");
+    typename Policy::Rule rule("Expression5");
     auto&& root = Expression6();
     if (!root)
       return nullptr;
@@ -598,7 +742,7 @@ public:
   std::unique_ptr<ExpressionNode> Expression6()
   {
     //Expression6         = (<Asterisk> | <Ampersand> | <Plus> | <Minus> | <LogicalNot> | <Increment> | <Decrement>)* Expression7
-    PrintRule rule("Expression6");
+    typename Policy::Rule rule("Expression6");
 
     Token token;
     std::unique_ptr<UnaryOperatorNode> root = nullptr;
@@ -640,7 +784,7 @@ public:
   std::unique_ptr<ExpressionNode> Expression7()
   {
     //Expression7         = Value (MemberAccess | Call | Cast | Index)*
-    PrintRule rule("Expression7");
+    typename Policy::Rule rule("Expression7");
     std::unique_ptr<ExpressionNode>&& root = Value();
     if (!root)
       return nullptr;
@@ -680,10 +824,129 @@ public:
   }
 
 
+  // Parses the same expressions into the same trees as Expression to Expression7, but every binary operator level is
+  // handled by one loop driven by cExpressionOperators (so a lone literal is a few calls deep instead of a dozen)
+  // Consumes binary operators that bind at least as tightly as minPrecedence
+  std::unique_ptr<ExpressionNode> ClimbExpression(uint8_t minPrecedence)
+  {
+    auto&& root = UnaryExpression();
+    if (!root)
+      return nullptr;
+
+    while (HasToken())
+    {
+      int tokenType = PeekTokenType();
+      uint8_t precedence = cExpressionOperators.mBinaryPrecedence[tokenType];
+      if (precedence == 0 || precedence < minPrecedence)
+        break;
+
+      // A right to left operator takes everything at its own level on its right
+      Token token = TakeToken();
+      uint8_t rightPrecedence = precedence == ExpressionOperatorTable::cAssignmentPrecedence ? precedence : precedence + 1;
+      root = MakeBinaryNode(std::move(root), token, Expect(ClimbExpression(rightPrecedence)));
+    }
+    return std::move(root);
+  }
+
+  // Expression6 (right to left unary operators) over PostfixExpression
+  std::unique_ptr<ExpressionNode> UnaryExpression()
+  {
+    std::unique_ptr<UnaryOperatorNode> root = nullptr;
+    UnaryOperatorNode* current = nullptr;
+    while (HasToken() && cExpressionOperators.mIsUnary[PeekTokenType()])
+    {
+      auto&& node = std::make_unique<UnaryOperatorNode>();
+      node->mOperator = TakeToken();
+      UnaryOperatorNode* nodePtr = node.get();
+
+      if (root == nullptr)
+        root = std::move(node);
+      else
+        current->mRight = std::move(node);
+      current = nodePtr;
+    }
+
+    std::unique_ptr<ExpressionNode> operand = PostfixExpression();
+    if (operand == nullptr)
+      return nullptr;
+    if (current == nullptr)
+      return operand;
+
+    current->mRight = std::move(operand);
+    return root;
+  }
+
+  // Expression7, picking the value and each postfix operator by the next token's type
+  std::unique_ptr<ExpressionNode> PostfixExpression()
+  {
+    std::unique_ptr<ExpressionNode> root = PrimaryExpression();
+    if (!root)
+      return nullptr;
+
+    while (HasToken())
+    {
+      std::unique_ptr<PostExpressionNode> node;
+      switch (PeekTokenType())
+      {
+      case TokenType::Dot:
+      case TokenType::Arrow:
+        node = MemberAccess();
+        break;
+      case TokenType::OpenParentheses:
+        node = Call();
+        break;
+      case TokenType::As:
+        node = Cast();
+        break;
+      case TokenType::OpenBracket:
+        node = Index();
+        break;
+      default:
+        return root;
+      }
+      node->mLeft = std::move(root);
+      root = std::move(node);
+    }
+    return root;
+  }
+
+  // Value (a literal, name or grouped expression)
+  std::unique_ptr<ExpressionNode> PrimaryExpression()
+  {
+    if (!HasToken())
+      return nullptr;
+
+    switch (PeekTokenType())
+    {
+    case TokenType::True:
+    case TokenType::False:
+    case TokenType::Null:
+    case TokenType::IntegerLiteral:
+    case TokenType::FloatLiteral:
+    case TokenType::StringLiteral:
+    case TokenType::CharacterLiteral:
+    {
+      auto&& node = std::make_unique<LiteralNode>();
+      node->mToken = TakeToken();
+      return std::move(node);
+    }
+    case TokenType::Identifier:
+    {
+      auto&& node = std::make_unique<NameReferenceNode>();
+      node->mName = TakeToken();
+      return std::move(node);
+    }
+    case TokenType::OpenParentheses:
+      return GroupedExpression();
+    default:
+      return nullptr;
+    }
+  }
+
   std::unique_ptr<MemberAccessNode> MemberAccess()
   {
     //MemberAccess        = (<Dot> | <Arrow>) <Identifier>
-    PrintRule rule("MemberAccess");
+    typename Policy::Rule rule("MemberAccess");
     Token operatorToken;
     if (!(Accept(TokenType::Dot, &operatorToken) || Accept(TokenType::Arrow, &operatorToken)))
       return false;
@@ -697,7 +960,7 @@ public:
   std::unique_ptr<CallNode> Call()
   {
     //Call                = <OpenParentheses> (Expression (<Comma> Expression)*)? <CloseParentheses>
-    PrintRule rule("Call");
+    typename Policy::Rule rule("Call");
     if (!Accept(TokenType::OpenParentheses))
       return false;
 
@@ -715,7 +978,7 @@ public:
   std::unique_ptr<CastNode> Cast()
   {
     //Cast                = <As> Type
-    PrintRule rule("Cast");
+    typename Policy::Rule rule("Cast");
     if (!Accept(TokenType::As))
       return false;
 
@@ -727,7 +990,7 @@ public:
   std::unique_ptr<IndexNode> Index()
   {
     //Index = <OpenBracket> Expression <CloseBracket>
-    PrintRule rule("Index");
+    typename Policy::Rule rule("Index");
     if (!Accept(TokenType::OpenBracket))
       return nullptr;
 
@@ -738,15 +1001,63 @@ public:
     return rule.Accept(std::move(node));
   }
 
+  bool HasToken() const
+  {
+    if (mStream != nullptr)
+      return !mStream->IsAtEnd();
+    if (mBuffer != nullptr)
+      return mTokenIndex < mBuffer->GetCount();
+    return mTokenIndex < mTokenCount;
+  }
+
+  // The type of the next unread token (HasToken must be true)
+  int PeekTokenType() const
+  {
+    if (mStream != nullptr)
+      return mStream->Peek().mTokenType;
+    if (mBuffer != nullptr)
+      return mBuffer->GetType(TokenId((uint32_t)mTokenIndex));
+    return mTokens[mTokenIndex].mTokenType;
+  }
+
+  // The next unread token (HasToken must be true)
+  Token PeekToken() const
+  {
+    if (mStream != nullptr)
+      return mStream->Peek();
+    if (mBuffer != nullptr)
+      return mBuffer->GetToken(TokenId((uint32_t)mTokenIndex));
+    return mTokens[mTokenIndex];
+  }
+
+  // Returns the next unread token and moves past it (HasToken must be true)
+  Token TakeToken()
+  {
+    if (mStream != nullptr)
+    {
+      Token token = mStream->Peek();
+      mStream->Advance();
+      return token;
+    }
+    if (mBuffer != nullptr)
+    {
+      // The buffer only keeps the text and type, so what the scanner records is filled in as each token is taken
+      Token token = mBuffer->GetToken(TokenId((uint32_t)mTokenIndex++));
+      AnnotateLanguageToken(token);
+      return token;
+    }
+    return mTokens[mTokenIndex++];
+  }
+
   bool Accept(TokenType::Enum tokenType, Token* token = nullptr)
   {
-    size_t index = mTokenIndex;
-    if (mTokenIndex < mTokens.size() && mTokens[index].mTokenType == tokenType)
+    if (HasToken() && PeekTokenType() == tokenType)
     {
-      ++mTokenIndex;
-      if (token != nullptr)
-        *token = mTokens[index];
-      PrintRule::AcceptedToken(mTokens[index]);
+      // Read the token straight into the caller's token when there is one
+      Token accepted;
+      Token& target = token != nullptr ? *token : accepted;
+      target = TakeToken();
+      Policy::AcceptedToken(target);
       return true;
     }
     return false;
@@ -760,7 +1071,7 @@ public:
   bool Expect(bool state)
   {
     if (!state)
-      throw ParsingException();
+      Fail();
     return state;
   }
 
@@ -768,10 +1079,40 @@ public:
   std::unique_ptr<T> Expect(std::unique_ptr<T> ptr)
   {
     if (!ptr)
-      throw ParsingException();
+      Fail();
     return ptr;
   }
 
-  std::vector<Token> mTokens;
+  // Throws a ParsingException naming the token parsing stopped at (and where it is, if there is a line index)
+  [[noreturn]] void Fail() const
+  {
+    if (!HasToken())
+      throw ParsingException("Unexpected end of input");
+
+    Token token = PeekToken();
+    std::string error = "Unexpected '" + token.str() + "'";
+    if (mLineIndex != nullptr)
+      error += " at " + mLineIndex->GetLocation(token).str();
+    throw ParsingException(error);
+  }
+
+  // The span of tokens being parsed (not owned)
+  const Token* mTokens = nullptr;
+  size_t mTokenCount = 0;
   size_t mTokenIndex = 0;
+  // When set, tokens come from the stream or the buffer instead of mTokens
+  TokenStream* mStream = nullptr;
+  const TokenBuffer* mBuffer = nullptr;
+  const LineIndex* mLineIndex = nullptr;
 };
+
+typedef BasicParser<DefaultParserPolicy> Parser;
+
+// The same as the driver's ParseExpression / ParseBlock, but pulling tokens from a stream or a compact buffer
+std::unique_ptr<ExpressionNode> ParseExpression(TokenStream& stream);
+std::unique_ptr<BlockNode> ParseBlock(TokenStream& stream);
+std::unique_ptr<ExpressionNode> ParseExpression(const TokenBuffer& buffer);
+std::unique_ptr<BlockNode> ParseBlock(const TokenBuffer& buffer);
+// Scans and parses the whole file, and the tree holds on to the file so its tokens stay valid
+// Throws a ParsingException when the file is null (SourceFile::Load couldn't open it) or too large to tokenize
+std::unique_ptr<BlockNode> ParseBlock(const std::shared_ptr<const SourceFile>& file);
@@ -0,0 +1,411 @@
+/******************************************************************\
+ * Author:
+ * Copyright 2015, DigiPen Institute of Technology
+\******************************************************************/
+#include "../Drivers/Driver1.hpp"
+
+#include <chrono>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "Dfa.hpp"
+#include "LanguageRules.hpp"
+#include "ScannerGenerator.hpp"
+#include "SourceFile.hpp"
+#include "StaticDfa.hpp"
+#include "Tokenizer.hpp"
+
+// Built by the Benchmark configuration
+#if SCANNER_BENCHMARK
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// The CPU's time stamp counter, or 0 where there isn't one (cycles per byte are then not reported)
+static uint64_t ReadCycleCounter()
+{
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+typedef void (*TokenizeFn)(const DfaTable& table, const char* stream, std::vector<Token>& tokensOut);
+
+static std::string Repeat(const char* text, size_t length)
+{
+  std::string result;
+  while (result.size() < length)
+    result += text;
+  result.resize(length);
+  return result;
+}
+
+static double TimeTokenize(TokenizeFn tokenize, const DfaTable& table, const std::string& stream, std::vector<Token>& tokensOut)
+{
+  auto begin = std::chrono::steady_clock::now();
+  tokensOut.clear();
+  tokenize(table, stream.c_str(), tokensOut);
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+static bool SameTokens(const std::vector<Token>& a, const std::vector<Token>& b)
+{
+  if (a.size() != b.size())
+    return false;
+  for (size_t i = 0; i < a.size(); ++i)
+  {
+    if (a[i].mText != b[i].mText || a[i].mLength != b[i].mLength || a[i].mTokenType != b[i].mTokenType)
+      return false;
+  }
+  return true;
+}
+
+// Doubles the input size for each pattern: the plain tokenizer grows quadratically on the adversarial
+// inputs while the linear tokenizer keeps growing with the size of the input
+static void RunLinearBenchmark(const DfaTable& table)
+{
+  struct Pattern
+  {
+    const char* mName;
+    const char* mText;
+  };
+  const Pattern patterns[] =
+  {
+    // Every '/' is a Divide token, but scanning it continues into a block comment that never ends
+    { "unterminated comments", "/*a" },
+    // Every '/' is a Divide token, but scanning it continues into a line comment that never ends
+    { "slashes", "/" },
+    { "regular code", "var a : Integer = 5; // comment\n  if (a > 3) { Print(\"hello\\tworld\"); }\n" },
+  };
+
+  printf("%-22s %10s %10s %12s %12s\n", "Input", "Bytes", "Tokens", "Plain (ms)", "Linear (ms)");
+  for (const Pattern& pattern : patterns)
+  {
+    for (size_t length = 1024; length <= 32 * 1024; length *= 2)
+    {
+      std::string stream = Repeat(pattern.mText, length);
+      std::vector<Token> plainTokens;
+      std::vector<Token> linearTokens;
+      double plain = TimeTokenize(TokenizeStream, table, stream, plainTokens);
+      double linear = TimeTokenize(TokenizeStreamLinear, table, stream, linearTokens);
+      printf("%-22s %10d %10d %12.3f %12.3f%s\n", pattern.mName, (int)length, (int)plainTokens.size(), plain, linear,
+        SameTokens(plainTokens, linearTokens) ? "" : "  MISMATCH");
+    }
+  }
+}
+
+// Tokenizes one large generated bundle with an increasing number of threads
+static void RunParallelBenchmark(const DfaTable& table)
+{
+  const char* code =
+    "class Player\n{\n  var Health : Float = 99.0f;\n  /* Remaining lives\n     (never negative) */\n  var Lives : Integer = 3;\n}\n"
+    "function Update(player : Player*) : Integer\n{\n  // Keep everyone alive\n  if (player->Health < 0.5e1) { Print(\"low health\\n\"); }\n  return player->Lives;\n}\n";
+  std::string stream = Repeat(code, 32 * 1024 * 1024);
+
+  std::vector<Token> sequentialTokens;
+  double sequential = TimeTokenize(TokenizeStream, table, stream, sequentialTokens);
+  printf("\n%-10s %12s %12s\n", "Threads", "Time (ms)", "MB/s");
+  printf("%-10s %12.3f %12.1f\n", "sequential", sequential, stream.size() / (sequential * 1000.0));
+
+  for (size_t threadCount = 1; threadCount <= 16; threadCount *= 2)
+  {
+    std::vector<Token> parallelTokens;
+    auto begin = std::chrono::steady_clock::now();
+    TokenizeStreamParallel(table, stream.c_str(), parallelTokens, threadCount);
+    auto end = std::chrono::steady_clock::now();
+    double parallel = std::chrono::duration<double, std::milli>(end - begin).count();
+    printf("%-10d %12.3f %12.1f%s\n", (int)threadCount, parallel, stream.size() / (parallel * 1000.0),
+      SameTokens(sequentialTokens, parallelTokens) ? "" : "  MISMATCH");
+  }
+}
+
+// Tokenizes a file straight out of its mapping
+static bool RunFileBenchmark(const DfaTable& table, const char* path)
+{
+  auto begin = std::chrono::steady_clock::now();
+  std::shared_ptr<const SourceFile> file = SourceFile::Load(path);
+  if (file == nullptr)
+  {
+    printf("Unable to open '%s'\n", path);
+    return false;
+  }
+
+  std::vector<Token> tokens;
+  TokenizeStream(table, file->GetText(), tokens);
+  auto end = std::chrono::steady_clock::now();
+  double time = std::chrono::duration<double, std::milli>(end - begin).count();
+  printf("%s (%s): %d bytes, %d tokens, %.3f ms, %.1f MB/s\n", path, file->IsMapped() ? "mapped" : "copied",
+    (int)file->GetLength(), (int)tokens.size(), time, file->GetLength() / (time * 1000.0));
+  return true;
+}
+
+// Driver1Part2Test6, the most realistic of the driver's tests
+static const char* cMixedCode =
+  "class Player\n"
+  "{\n"
+  "  var Health : float = 99.0f;\n"
+  "}\n"
+  "\n"
+  "function main()\n"
+  "{\n"
+  "  // Do some simple test /*\n"
+  "  var a = 5;\n"
+  "  var b : int = 1;\n"
+  "  if (a > b)\n"
+  "  {\n"
+  "    ++a;\n"
+  "    b +=-(a+ b) *+2;\n"
+  "    Print(\"hello\tworld\"); /* multi-line \"comment\"! */\n"
+  "    Print(\"b's value is: \", b);\n"
+  "    Print('c');\n"
+  "    Print(5.ToString());\n"
+  "    \n"
+  "    for (int i = 0; i < 99 / 2; ++i)\n"
+  "    {\n"
+  "      Print(i);\n"
+  "    }\n"
+  "    \n"
+  "    var p = Player();\n"
+  "    Print(p.Health);\n"
+  "  }\n"
+  "}\n";
+
+// Builds a corpus of exactly 'length' bytes out of pieces from the generator (the same every run)
+template <typename Generator>
+static std::string GenerateCorpus(size_t length, Generator generator)
+{
+  std::mt19937 random(375);
+  std::string result;
+  result.reserve(length + 256);
+  while (result.size() < length)
+    generator(random, result);
+  // Cut at the last line break so the final token is whole
+  size_t end = result.rfind('\n', length);
+  result.resize(end == std::string::npos ? length : end + 1);
+  return result;
+}
+
+static void AppendIdentifier(std::mt19937& random, std::string& out)
+{
+  const char* cFirst = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ_";
+  const char* cRest = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789";
+  size_t length = 1 + random() % 16;
+  out += cFirst[random() % 53];
+  for (size_t i = 1; i < length; ++i)
+    out += cRest[random() % 63];
+}
+
+static void AppendDigits(std::mt19937& random, std::string& out, size_t maxCount)
+{
+  size_t count = 1 + random() % maxCount;
+  for (size_t i = 0; i < count; ++i)
+    out += (char)('0' + random() % 10);
+}
+
+static void GenerateIdentifiers(std::mt19937& random, std::string& out)
+{
+  const char* cKeywords[] = { "var", "function", "class", "if", "while", "return", "Integer", "Float" };
+  for (size_t i = 0; i < 8; ++i)
+  {
+    if (random() % 4 == 0)
+      out += cKeywords[random() % 8];
+    else
+      AppendIdentifier(random, out);
+    out += ' ';
+  }
+  out += '\n';
+}
+
+static void GenerateNumbers(std::mt19937& random, std::string& out)
+{
+  for (size_t i = 0; i < 8; ++i)
+  {
+    AppendDigits(random, out, 10);
+    if (random() % 2 == 0)
+    {
+      out += '.';
+      AppendDigits(random, out, 8);
+      if (random() % 2 == 0)
+      {
+        out += "e-";
+        AppendDigits(random, out, 2);
+      }
+      if (random() % 2 == 0)
+        out += 'f';
+    }
+    out += ", ";
+  }
+  out += '\n';
+}
+
+static void GenerateComments(std::mt19937& random, std::string& out)
+{
+  bool block = random() % 2 == 0;
+  out += block ? "/* " : "// ";
+  for (size_t i = 0, count = 2 + random() % 10; i < count; ++i)
+  {
+    AppendIdentifier(random, out);
+    out += (block && random() % 4 == 0) ? "\n * " : " ";
+  }
+  out += block ? "*/\n" : "\n";
+}
+
+static void GenerateStrings(std::mt19937& random, std::string& out)
+{
+  out += "Print(\"";
+  for (size_t i = 0, count = 2 + random() % 10; i < count; ++i)
+  {
+    AppendIdentifier(random, out);
+    out += random() % 4 == 0 ? "\\n" : " ";
+  }
+  out += "\", 'c');\n";
+}
+
+static void GenerateMixed(std::mt19937&, std::string& out)
+{
+  out += cMixedCode;
+}
+
+// The language DFA as a walked graph, a runtime compiled table, the static table and (when built in) the generated code
+static DfaState* sGraphRoot = nullptr;
+static DfaState* sTableRoot = nullptr;
+
+static void ReadGraphToken(const char* stream, Token& outToken)
+{
+  ReadToken(sGraphRoot, stream, outToken);
+}
+
+// These read the tables directly (ReadLanguageToken would run the generated scanner in a DIRECT_CODED_SCANNER build)
+static void ReadCompiledToken(const char* stream, Token& outToken)
+{
+  ReadTableToken(*sTableRoot->mTable, stream, outToken);
+}
+
+static void ReadStaticToken(const char* stream, Token& outToken)
+{
+  ReadTableToken(GetStaticLanguageTable(), stream, outToken);
+}
+
+typedef void (*ReadTokenFn)(const char* stream, Token& outToken);
+
+// Reads every token of each corpus with each DFA variant (nothing is stored or printed)
+static void RunThroughputBenchmark(size_t length)
+{
+  // Walking the graph needs the graph without its compiled table
+  DfaMinimizeReport report;
+  sGraphRoot = BuildLanguageDfa(&report);
+  sGraphRoot->mTable = nullptr;
+  sTableRoot = BuildLanguageDfa();
+  printf("\nMinimized the language DFA\n");
+  report.Print();
+
+  struct Corpus
+  {
+    const char* mName;
+    std::string mText;
+  };
+  const Corpus corpora[] =
+  {
+    { "identifiers", GenerateCorpus(length, GenerateIdentifiers) },
+    { "numbers", GenerateCorpus(length, GenerateNumbers) },
+    { "comments", GenerateCorpus(length, GenerateComments) },
+    { "strings", GenerateCorpus(length, GenerateStrings) },
+    { "mixed", GenerateCorpus(length, GenerateMixed) },
+  };
+
+  struct Variant
+  {
+    const char* mName;
+    ReadTokenFn mRead;
+  };
+  const Variant variants[] =
+  {
+    { "graph", ReadGraphToken },
+    { "runtime table", ReadCompiledToken },
+    { "static table", ReadStaticToken },
+#if DIRECT_CODED_SCANNER
+    { "direct coded", ReadDirectCodedToken },
+#endif
+  };
+
+  printf("\n%-12s %-14s %10s %12s %10s %14s %12s\n", "Corpus", "DFA", "Bytes", "Tokens", "MB/s", "Tokens/s", "Cycles/byte");
+  for (const Corpus& corpus : corpora)
+  {
+    for (const Variant& variant : variants)
+    {
+      size_t tokenCount = 0;
+      auto begin = std::chrono::steady_clock::now();
+      uint64_t beginCycles = ReadCycleCounter();
+      const char* stream = corpus.mText.c_str();
+      while (*stream != '\0')
+      {
+        Token token;
+        variant.mRead(stream, token);
+        // A byte no token starts with is skipped, but isn't a token
+        if (token.mLength == 0)
+        {
+          ++stream;
+          continue;
+        }
+        stream += token.mLength;
+        ++tokenCount;
+      }
+      uint64_t cycles = ReadCycleCounter() - beginCycles;
+      double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+      size_t bytes = corpus.mText.size();
+      printf("%-12s %-14s %10zu %12zu %10.1f %14.0f", corpus.mName, variant.mName, bytes, tokenCount,
+        bytes / (seconds * 1000000.0), tokenCount / seconds);
+      if (cycles != 0)
+        printf(" %12.2f\n", (double)cycles / bytes);
+      else
+        printf(" %12s\n", "n/a");
+    }
+  }
+
+  DeleteStateAndChildren(sGraphRoot);
+  DeleteStateAndChildren(sTableRoot);
+}
+
+// With no arguments runs the built in benchmarks
+// "--size <MB>" only runs the throughput benchmark, on corpora of that size (1 to 1024), otherwise each argument is a file to tokenize
+int main(int argc, char* argv[])
+{
+  const DfaTable& table = GetStaticLanguageTable();
+  if (argc == 3 && strcmp(argv[1], "--size") == 0)
+  {
+    size_t megabytes = (size_t)atoi(argv[2]);
+    if (megabytes < 1 || megabytes > 1024)
+    {
+      printf("The corpus size must be between 1 and 1024 MB\n");
+      return 1;
+    }
+    RunThroughputBenchmark(megabytes * 1024 * 1024);
+    return 0;
+  }
+
+  if (argc > 1)
+  {
+    bool succeeded = true;
+    for (int i = 1; i < argc; ++i)
+      succeeded = RunFileBenchmark(table, argv[i]) && succeeded;
+    return succeeded ? 0 : 1;
+  }
+
+  RunLinearBenchmark(table);
+  RunParallelBenchmark(table);
+  RunThroughputBenchmark(1024 * 1024);
+  RunThroughputBenchmark(16 * 1024 * 1024);
+  return 0;
+}
+
+#endif
@@ -0,0 +1,178 @@
+/******************************************************************\
+ * Author:
+ * Copyright 2015, DigiPen Institute of Technology
+\******************************************************************/
+#include "../Drivers/Driver1.hpp"
+
+#include <algorithm>
+#include <ctype.h>
+#include <vector>
+#include "Dfa.hpp"
+#include "LanguageRules.hpp"
+#include "ScannerGenerator.hpp"
+
+// Prints a byte as a case label value that is easy to read in the generated code
+static void WriteCaseValue(FILE* file, size_t byte)
+{
+  if (byte < 0x80 && isgraph((int)byte) && byte != '\'' && byte != '\\')
+    fprintf(file, "'%c'", (char)byte);
+  else
+    fprintf(file, "0x%02X", (unsigned)byte);
+}
+
+static void WriteTokenType(FILE* file, int tokenType)
+{
+  if (tokenType > 0 && tokenType < TokenType::EnumCount)
+    fprintf(file, "TokenType::%s", TokenNames[tokenType]);
+  else
+    fprintf(file, "%d", tokenType);
+}
+
+void WriteDirectCodedScanner(const DfaTable& table, const char* functionName, FILE* file)
+{
+  // Only states that some edge moves into need an entry label (which consumes the byte and records accepting)
+  // The start state is entered without consuming anything, so it is dispatched directly
+  std::vector<bool> entered(table.mStateCount, false);
+  for (size_t state = DfaTable::cStartState; state < table.mStateCount; ++state)
+  {
+    for (size_t c = 0; c < table.mClassCount; ++c)
+      entered[table.mTransitions[state * table.mClassCount + c]] = true;
+  }
+
+  fprintf(file, "// Generated by WriteDirectCodedScanner (ScannerGenerator.cpp), do not edit by hand\n");
+  fprintf(file, "// States: %d, byte classes: %d\n", (int)table.mStateCount, (int)table.mClassCount);
+  fprintf(file, "void %s(const char* stream, Token& outToken)\n", functionName);
+  fprintf(file, "{\n");
+  fprintf(file, "  const char* position = stream;\n");
+  fprintf(file, "  const char* accepted = stream;\n");
+  fprintf(file, "  int acceptedToken = 0;\n");
+  // The start state is the first one written, so it only needs a jump if something loops back into it
+  if (entered[DfaTable::cStartState])
+    fprintf(file, "  goto dispatch%d;\n", (int)DfaTable::cStartState);
+
+  std::vector<size_t> targets;
+  for (size_t state = DfaTable::cStartState; state < table.mStateCount; ++state)
+  {
+    const uint16_t* row = table.mTransitions + state * table.mClassCount;
+    int acceptingToken = table.mAcceptingTokens[state];
+
+    fprintf(file, "\n");
+    if (entered[state])
+    {
+      fprintf(file, "state%d:\n", (int)state);
+      fprintf(file, "  ++position;\n");
+      if (acceptingToken != 0)
+      {
+        fprintf(file, "  acceptedToken = ");
+        WriteTokenType(file, acceptingToken);
+        fprintf(file, ";\n");
+        fprintf(file, "  accepted = position;\n");
+      }
+    }
+    if (state == DfaTable::cStartState && entered[state])
+      fprintf(file, "dispatch%d:\n", (int)state);
+
+    // The most common target becomes the default case, every other target lists its bytes
+    // The null terminator always ends the token (even if the automaton has an edge on it)
+    std::vector<size_t> counts(table.mStateCount, 0);
+    for (size_t c = 1; c < DfaTable::cAlphabetSize; ++c)
+      ++counts[row[table.mByteClasses[c]]];
+    size_t defaultTarget = DfaTable::cDeadState;
+    for (size_t target = 0; target < table.mStateCount; ++target)
+    {
+      if (counts[target] > counts[defaultTarget])
+        defaultTarget = target;
+    }
+
+    targets.clear();
+    for (size_t c = 0; c < DfaTable::cAlphabetSize; ++c)
+    {
+      size_t target = c == 0 ? DfaTable::cDeadState : row[table.mByteClasses[c]];
+      if (target != defaultTarget && std::find(targets.begin(), targets.end(), target) == targets.end())
+        targets.push_back(target);
+    }
+
+    fprintf(file, "  switch ((unsigned char)*position)\n");
+    fprintf(file, "  {\n");
+    for (size_t target : targets)
+    {
+      fprintf(file, "  ");
+      size_t caseCount = 0;
+      for (size_t c = 0; c < DfaTable::cAlphabetSize; ++c)
+      {
+        size_t byteTarget = c == 0 ? DfaTable::cDeadState : row[table.mByteClasses[c]];
+        if (byteTarget != target)
+          continue;
+        if (caseCount != 0 && caseCount % 8 == 0)
+          fprintf(file, "\n  ");
+        else if (caseCount != 0)
+          fprintf(file, " ");
+        fprintf(file, "case ");
+        WriteCaseValue(file, c);
+        fprintf(file, ":");
+        ++caseCount;
+      }
+      if (target == DfaTable::cDeadState)
+        fprintf(file, "\n    goto done;\n");
+      else
+        fprintf(file, "\n    goto state%d;\n", (int)target);
+    }
+    if (defaultTarget == DfaTable::cDeadState)
+      fprintf(file, "  default:\n    goto done;\n");
+    else
+      fprintf(file, "  default:\n    goto state%d;\n", (int)defaultTarget);
+    fprintf(file, "  }\n");
+  }
+
+  fprintf(file, "\n");
+  fprintf(file, "done:\n");
+  fprintf(file, "  outToken.mText = stream;\n");
+  fprintf(file, "  outToken.mLength = (size_t)(position - stream);\n");
+  fprintf(file, "  if (acceptedToken != 0)\n");
+  fprintf(file, "  {\n");
+  fprintf(file, "    outToken.mTokenType = acceptedToken;\n");
+  fprintf(file, "    outToken.mLength = (size_t)(accepted - stream);\n");
+  fprintf(file, "  }\n");
+  fprintf(file, "}\n");
+}
+
+bool WriteLanguageScanner(const char* fileName, DfaMinimizeReport* reportOut)
+{
+  FILE* file = fopen(fileName, "w");
+  if (file == nullptr)
+    return false;
+
+  // The graph goes through the same AddState / AddEdge rules (and minimization) as the table driven scanner
+  DfaState* root = BuildLanguageDfa(reportOut);
+  if (root->mTable == nullptr)
+  {
+    DeleteStateAndChildren(root);
+    fclose(file);
+    return false;
+  }
+  WriteDirectCodedScanner(*root->mTable, "ReadDirectCodedToken", file);
+  DeleteStateAndChildren(root);
+  fclose(file);
+  return true;
+}
+
+#if DIRECT_CODED_SCANNER
+#include "GeneratedScanner.inl"
+#endif
+
+#if SCANNER_GENERATOR
+int main(int argc, char* argv[])
+{
+  const char* fileName = argc > 1 ? argv[1] : "GeneratedScanner.inl";
+  DfaMinimizeReport report;
+  if (!WriteLanguageScanner(fileName, &report))
+  {
+    printf("Unable to open '%s' for writing\n", fileName);
+    return 1;
+  }
+  printf("Wrote the language scanner to '%s'\n", fileName);
+  printf("Minimized the language DFA\n");
+  report.Print();
+  return 0;
+}
+#endif
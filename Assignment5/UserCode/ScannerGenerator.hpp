@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Dfa.hpp"
+
+#include <stdio.h>
+
+// Writes a DFA out as direct-coded C++ (one label per state and a switch on each byte, in the style of re2c)
+// The emitted function has the signature 'void functionName(const char* stream, Token& outToken)' and reads
+// exactly the same tokens as ReadTableToken on the given table
+void WriteDirectCodedScanner(const DfaTable& table, const char* functionName, FILE* file);
+
+// Generates the direct-coded version of the language DFA (see BuildLanguageDfa)
+// Returns false if the file could not be opened (or the language is too large to compile)
+bool WriteLanguageScanner(const char* fileName, DfaMinimizeReport* reportOut = nullptr);
+
+// The generated language scanner (GeneratedScanner.inl), only compiled in when DIRECT_CODED_SCANNER is defined
+// (the DirectScanner, Tests and Benchmark configurations). Regenerate it by building the ScannerGenerator configuration
+// and running it with the path of the file. The equivalence tests fail while it is out of date
+#if DIRECT_CODED_SCANNER
+void ReadDirectCodedToken(const char* stream, Token& outToken);
+#endif
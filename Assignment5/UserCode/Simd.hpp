@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <stddef.h>
+
+// Picks the widest vector instructions the compiler is allowed to use (SSE2 is always there on x64)
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define SIMD_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SIMD_SSE2 1
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// The index of the lowest set bit (the mask must not be 0)
+inline size_t CountTrailingZeros(uint32_t mask)
+{
+#if defined(_MSC_VER)
+  unsigned long result;
+  _BitScanForward(&result, mask);
+  return result;
+#else
+  return (size_t)__builtin_ctz(mask);
+#endif
+}
@@ -0,0 +1,201 @@
+/******************************************************************\
+ * Author:
+ * Copyright 2015, DigiPen Institute of Technology
+\******************************************************************/
+#include "SourceFile.hpp"
+
+#include <stdio.h>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static size_t GetPageSize()
+{
+#if defined(_WIN32)
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  return info.dwPageSize;
+#else
+  return (size_t)sysconf(_SC_PAGESIZE);
+#endif
+}
+
+SourceFile::SourceFile() :
+  mText(""),
+  mLength(0),
+  mMapping(nullptr),
+  mMappingSize(0)
+#if defined(_WIN32)
+  , mFile(nullptr)
+#endif
+{
+}
+
+SourceFile::~SourceFile()
+{
+  Close();
+}
+
+std::shared_ptr<const SourceFile> SourceFile::Load(const char* path)
+{
+  auto file = std::make_shared<SourceFile>();
+  if (!file->Open(path))
+    return nullptr;
+  return file;
+}
+
+bool SourceFile::Open(const char* path)
+{
+  Close();
+
+#if defined(_WIN32)
+  // No write sharing, so the file keeps its size (and its zero filled last page) for as long as it is mapped
+  HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  // Someone else may have it open for writing
+  if (file == INVALID_HANDLE_VALUE)
+    return ReadCopy(path);
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size))
+  {
+    CloseHandle(file);
+    return false;
+  }
+  size_t length = (size_t)size.QuadPart;
+  size_t mappingSize = length;
+
+  // An empty file can't be mapped, and a file that fills its last page has no room for the terminator
+  if (length == 0 || length % GetPageSize() == 0)
+  {
+    CloseHandle(file);
+    return ReadCopy(path);
+  }
+
+  HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (mapping == nullptr)
+  {
+    CloseHandle(file);
+    return ReadCopy(path);
+  }
+
+  void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  // The view keeps the mapping alive
+  CloseHandle(mapping);
+  if (view == nullptr)
+  {
+    CloseHandle(file);
+    return ReadCopy(path);
+  }
+  mFile = file;
+#else
+  int file = open(path, O_RDONLY);
+  if (file < 0)
+    return false;
+
+  struct stat before;
+  if (fstat(file, &before) != 0)
+  {
+    close(file);
+    return false;
+  }
+  size_t length = (size_t)before.st_size;
+
+  // An empty file can't be mapped
+  if (length == 0)
+  {
+    close(file);
+    return ReadCopy(path);
+  }
+
+  // Only the whole pages of the file are mapped. The rest is read into a private page after them, so the terminator
+  // is in memory the file can't reach (a mapped partial page would show whatever the file grows into)
+  size_t pageSize = GetPageSize();
+  size_t wholeLength = length - length % pageSize;
+  size_t tailLength = length - wholeLength;
+  size_t mappingSize = wholeLength + pageSize;
+  char* view = (char*)mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (view == MAP_FAILED)
+  {
+    close(file);
+    return ReadCopy(path);
+  }
+
+  bool mapped = wholeLength == 0 || mmap(view, wholeLength, PROT_READ, MAP_PRIVATE | MAP_FIXED, file, 0) != MAP_FAILED;
+  bool read = mapped && pread(file, view + wholeLength, tailLength, (off_t)wholeLength) == (ssize_t)tailLength;
+  // A file that changed while it was being mapped is copied instead
+  struct stat after;
+  bool unchanged = read && fstat(file, &after) == 0 && after.st_size == before.st_size && after.st_mtime == before.st_mtime;
+  // The mapping keeps the file alive
+  close(file);
+  if (!unchanged)
+  {
+    munmap(view, mappingSize);
+    return ReadCopy(path);
+  }
+
+  mprotect(view + wholeLength, pageSize, PROT_READ);
+  if (wholeLength != 0)
+    madvise(view, wholeLength, MADV_SEQUENTIAL);
+#endif
+
+  mMapping = view;
+  mMappingSize = mappingSize;
+  mText = (const char*)view;
+  mLength = length;
+  return true;
+}
+
+void SourceFile::Close()
+{
+  if (mMapping != nullptr)
+  {
+#if defined(_WIN32)
+    UnmapViewOfFile(mMapping);
+#else
+    munmap(mMapping, mMappingSize);
+#endif
+  }
+#if defined(_WIN32)
+  if (mFile != nullptr)
+    CloseHandle(mFile);
+  mFile = nullptr;
+#endif
+
+  mMapping = nullptr;
+  mMappingSize = 0;
+  mCopy.clear();
+  mText = "";
+  mLength = 0;
+}
+
+bool SourceFile::ReadCopy(const char* path)
+{
+  FILE* file = fopen(path, "rb");
+  if (file == nullptr)
+    return false;
+
+  char buffer[64 * 1024];
+  size_t read = 0;
+  while ((read = fread(buffer, 1, sizeof(buffer), file)) != 0)
+    mCopy.insert(mCopy.end(), buffer, buffer + read);
+  bool failed = ferror(file) != 0;
+  fclose(file);
+  if (failed)
+  {
+    mCopy.clear();
+    return false;
+  }
+
+  mLength = mCopy.size();
+  mCopy.push_back('\0');
+  mText = mCopy.data();
+  return true;
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <stddef.h>
+#include <memory>
+#include <vector>
+
+// A source file mapped straight into memory, so tokens (and everything built from them, like the AST
+// and symbol table) can point into it without a read-and-copy step, and pages are only loaded when touched
+// The tokenizer needs a null terminated stream, so the terminator is never left to the file: on POSIX the whole pages
+// of the file are mapped in front of a private page that holds the partial last page and the terminator, and on
+// Windows the file is kept open without write sharing so nothing can change it under the mapping (a file that fills
+// its last page, or can't be mapped, is copied into memory with a terminator added)
+// If the file changes between being measured and mapped it is copied instead
+// Every token read from the text becomes invalid when the file is closed: share it with Load and parse it with
+// ParseBlock(file) so the AST holds on to it
+class SourceFile
+{
+public:
+  SourceFile();
+  ~SourceFile();
+
+  SourceFile(const SourceFile&) = delete;
+  SourceFile& operator=(const SourceFile&) = delete;
+
+  // An opened file that can be shared with whatever points into its text, or null if it could not be opened
+  static std::shared_ptr<const SourceFile> Load(const char* path);
+
+  // Returns false if the file could not be opened or read
+  bool Open(const char* path);
+  void Close();
+
+  // The null terminated contents of the file (an empty string when nothing is open)
+  const char* GetText() const
+  {
+    return mText;
+  }
+
+  size_t GetLength() const
+  {
+    return mLength;
+  }
+
+  // False when the file had to be copied
+  bool IsMapped() const
+  {
+    return mMapping != nullptr;
+  }
+
+private:
+  bool ReadCopy(const char* path);
+
+  const char* mText;
+  size_t mLength;
+  // The start of the mapped view (null when copied)
+  void* mMapping;
+  size_t mMappingSize;
+#if defined(_WIN32)
+  // Held open while mapped so the file can't be written
+  void* mFile;
+#endif
+  std::vector<char> mCopy;
+};
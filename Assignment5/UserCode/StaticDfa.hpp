@@ -0,0 +1,181 @@
+#pragma once
+
+#include "Dfa.hpp"
+#include "LanguageRules.hpp"
+
+// A Builder (see LanguageRules.hpp) that can run entirely at compile time
+// States are indices, where 0 is the dead state / 'no state'
+template <size_t Capacity>
+class StaticDfaBuilder
+{
+public:
+  typedef uint16_t State;
+  // The extra column after the alphabet holds the default edge
+  static const size_t cDefaultColumn = DfaTable::cAlphabetSize;
+  static const size_t cColumnCount = DfaTable::cAlphabetSize + 1;
+
+  constexpr StaticDfaBuilder() :
+    mEdges(),
+    mAcceptingTokens(),
+    mStateCount(1)
+  {
+  }
+
+  constexpr State AddState(int acceptingToken)
+  {
+    if (mStateCount >= Capacity)
+      throw "StaticDfaBuilder capacity exceeded";
+    State state = (State)mStateCount++;
+    mAcceptingTokens[state] = acceptingToken;
+    return state;
+  }
+
+  constexpr void AddEdge(State from, State to, char c)
+  {
+    mEdges[from * cColumnCount + (unsigned char)c] = to;
+  }
+
+  constexpr void AddDefaultEdge(State from, State to)
+  {
+    mEdges[from * cColumnCount + cDefaultColumn] = to;
+  }
+
+  constexpr State Find(State state, char c) const
+  {
+    State next = FindEdge(state, c);
+    if (next == State())
+      next = mEdges[state * cColumnCount + cDefaultColumn];
+    return next;
+  }
+
+  constexpr State FindEdge(State state, char c) const
+  {
+    return mEdges[state * cColumnCount + (unsigned char)c];
+  }
+
+  constexpr void CopyEdges(State to, State from)
+  {
+    for (size_t c = 0; c < cColumnCount; ++c)
+      mEdges[to * cColumnCount + c] = mEdges[from * cColumnCount + c];
+  }
+
+  constexpr void SetAcceptingToken(State state, int acceptingToken)
+  {
+    mAcceptingTokens[state] = acceptingToken;
+  }
+
+  // Folds each default edge into the empty entries of its row, after which FindEdge gives the same result as Find
+  // Only call this once all the rules are built (edges added afterwards would no longer override the default)
+  constexpr void ResolveDefaultEdges()
+  {
+    for (size_t state = 1; state < mStateCount; ++state)
+    {
+      uint16_t* row = mEdges + state * cColumnCount;
+      if (row[cDefaultColumn] == State())
+        continue;
+      for (size_t c = 0; c < DfaTable::cAlphabetSize; ++c)
+      {
+        if (row[c] == State())
+          row[c] = row[cDefaultColumn];
+      }
+    }
+  }
+
+  uint16_t mEdges[Capacity * cColumnCount];
+  int mAcceptingTokens[Capacity];
+  size_t mStateCount;
+};
+
+// Computes byte equivalence classes for a built StaticDfaBuilder (the same partition CompileDfa finds at runtime)
+// The builder's default edges must already be resolved (see ResolveDefaultEdges)
+// Two bytes share a class when every state sends them to the same place, so we hash each byte's column
+// and only compare whole columns when the hashes agree
+template <size_t Capacity>
+class StaticDfaClasses
+{
+public:
+  constexpr StaticDfaClasses(const StaticDfaBuilder<Capacity>& builder) :
+    mByteClasses(),
+    mClassBytes(),
+    mClassCount(0)
+  {
+    uint64_t hashes[DfaTable::cAlphabetSize] = {};
+    for (size_t c = 0; c < DfaTable::cAlphabetSize; ++c)
+    {
+      uint64_t hash = 14695981039346656037ull;
+      for (size_t state = 1; state < builder.mStateCount; ++state)
+        hash = (hash ^ builder.mEdges[state * builder.cColumnCount + c]) * 1099511628211ull;
+      hashes[c] = hash;
+    }
+
+    for (size_t c = 0; c < DfaTable::cAlphabetSize; ++c)
+    {
+      size_t byteClass = mClassCount;
+      for (size_t existing = 0; existing < mClassCount && byteClass == mClassCount; ++existing)
+      {
+        size_t other = mClassBytes[existing];
+        if (hashes[other] == hashes[c] && SameColumn(builder, other, c))
+          byteClass = existing;
+      }
+
+      if (byteClass == mClassCount)
+        mClassBytes[mClassCount++] = (uint8_t)c;
+      mByteClasses[c] = (uint8_t)byteClass;
+    }
+  }
+
+  static constexpr bool SameColumn(const StaticDfaBuilder<Capacity>& builder, size_t a, size_t b)
+  {
+    for (size_t state = 1; state < builder.mStateCount; ++state)
+    {
+      const uint16_t* row = builder.mEdges + state * builder.cColumnCount;
+      if (row[a] != row[b])
+        return false;
+    }
+    return true;
+  }
+
+  uint8_t mByteClasses[DfaTable::cAlphabetSize];
+  uint8_t mClassBytes[DfaTable::cAlphabetSize];
+  size_t mClassCount;
+};
+
+// The final flat arrays, sized exactly for the automaton so they can live in read-only memory
+template <size_t StateCount, size_t ClassCount>
+class StaticDfaTable
+{
+public:
+  template <size_t Capacity>
+  constexpr StaticDfaTable(const StaticDfaBuilder<Capacity>& builder, const StaticDfaClasses<Capacity>& classes) :
+    mByteClasses(),
+    mTransitions(),
+    mAcceptingTokens(),
+    mLoops()
+  {
+    for (size_t c = 0; c < DfaTable::cAlphabetSize; ++c)
+      mByteClasses[c] = classes.mByteClasses[c];
+
+    for (size_t state = 1; state < StateCount; ++state)
+    {
+      mAcceptingTokens[state] = builder.mAcceptingTokens[state];
+      const uint16_t* row = builder.mEdges + state * builder.cColumnCount;
+      for (size_t c = 0; c < ClassCount; ++c)
+        mTransitions[state * ClassCount + c] = row[classes.mClassBytes[c]];
+      mLoops[state] = FindDfaLoop(mTransitions + state * ClassCount, ClassCount, mByteClasses, (uint16_t)state);
+    }
+  }
+
+  constexpr DfaTable GetTable() const
+  {
+    return DfaTable(StateCount, ClassCount, mByteClasses, mTransitions, mAcceptingTokens, mLoops);
+  }
+
+  uint8_t mByteClasses[DfaTable::cAlphabetSize];
+  uint16_t mTransitions[StateCount * ClassCount];
+  int mAcceptingTokens[StateCount];
+  DfaLoop mLoops[StateCount];
+};
+
+// The language DFA built entirely at compile time from the same rules (and .inl files) as CreateLanguageDfa
+// This is a shared read-only table; it is never freed and may be used from any number of threads
+const DfaTable& GetStaticLanguageTable();
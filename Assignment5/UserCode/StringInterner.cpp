@@ -0,0 +1,142 @@
+/******************************************************************\
+ * Author:
+ * Copyright 2015, DigiPen Institute of Technology
+\******************************************************************/
+#include "StringInterner.hpp"
+
+#include "../Drivers/Driver2.hpp"
+
+#include <string.h>
+
+StringInterner::Table::Table(size_t size) :
+  mMask(size - 1),
+  mSlots(new std::atomic<Atom>[size])
+{
+  for (size_t i = 0; i < size; ++i)
+    mSlots[i].store(cInvalidAtom, std::memory_order_relaxed);
+}
+
+StringInterner::StringInterner() :
+  mChunks(new std::atomic<Entry*>[cMaxChunks]),
+  mCount(1),
+  mBlockUsed(0),
+  mBlockSize(0)
+{
+  for (size_t i = 0; i < cMaxChunks; ++i)
+    mChunks[i].store(nullptr, std::memory_order_relaxed);
+
+  // Entry 0 stands for cInvalidAtom
+  mOwnedChunks.emplace_back(new Entry[cChunkSize]);
+  mOwnedChunks.back()[0] = Entry{"", 0, 0};
+  mChunks[0].store(mOwnedChunks.back().get(), std::memory_order_relaxed);
+
+  mTables.emplace_back(new Table(256));
+  mTable.store(mTables.back().get(), std::memory_order_release);
+}
+
+StringInterner& StringInterner::GetInstance()
+{
+  static StringInterner interner;
+  return interner;
+}
+
+uint32_t StringInterner::Hash(const char* text, size_t length)
+{
+  // FNV-1a
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < length; ++i)
+    hash = (hash ^ (unsigned char)text[i]) * 16777619u;
+  return hash;
+}
+
+Atom StringInterner::Probe(const Table& table, const char* text, size_t length, uint32_t hash, size_t* emptySlot) const
+{
+  for (size_t slot = hash & table.mMask;; slot = (slot + 1) & table.mMask)
+  {
+    // Acquire pairs with the release in Intern, so the entry is complete before its atom can be seen
+    Atom atom = table.mSlots[slot].load(std::memory_order_acquire);
+    if (atom == cInvalidAtom)
+    {
+      if (emptySlot != nullptr)
+        *emptySlot = slot;
+      return cInvalidAtom;
+    }
+    const Entry& entry = GetEntry(atom);
+    if (entry.mHash == hash && entry.mLength == length && memcmp(entry.mText, text, length) == 0)
+      return atom;
+  }
+}
+
+Atom StringInterner::Find(const char* text, size_t length) const
+{
+  return Probe(*mTable.load(std::memory_order_acquire), text, length, Hash(text, length), nullptr);
+}
+
+Atom StringInterner::Intern(const char* text, size_t length)
+{
+  uint32_t hash = Hash(text, length);
+  Atom atom = Probe(*mTable.load(std::memory_order_acquire), text, length, hash, nullptr);
+  if (atom != cInvalidAtom)
+    return atom;
+
+  // Look again under the lock: another thread may have added the text (or a bigger table) since
+  std::lock_guard<std::mutex> lock(mMutex);
+  const Table& table = *mTable.load(std::memory_order_relaxed);
+  size_t slot = 0;
+  atom = Probe(table, text, length, hash, &slot);
+  if (atom != cInvalidAtom)
+    return atom;
+
+  atom = mCount.load(std::memory_order_relaxed);
+  if (atom >> cChunkBits >= cMaxChunks)
+    throw ParsingException("Too many distinct names (the string interner is full)");
+  if ((atom & (cChunkSize - 1)) == 0)
+  {
+    mOwnedChunks.emplace_back(new Entry[cChunkSize]);
+    mChunks[atom >> cChunkBits].store(mOwnedChunks.back().get(), std::memory_order_release);
+  }
+  Entry& entry = mChunks[atom >> cChunkBits].load(std::memory_order_relaxed)[atom & (cChunkSize - 1)];
+  entry.mText = CopyText(text, length);
+  entry.mLength = (uint32_t)length;
+  entry.mHash = hash;
+
+  table.mSlots[slot].store(atom, std::memory_order_release);
+  mCount.store(atom + 1, std::memory_order_release);
+
+  // Keep the table at most half full
+  if ((size_t)(atom + 1) * 2 > table.mMask + 1)
+    Grow();
+  return atom;
+}
+
+const char* StringInterner::CopyText(const char* text, size_t length)
+{
+  // Copy the text into the current block (long strings get a block of their own)
+  if (mBlocks.empty() || mBlockSize - mBlockUsed < length)
+  {
+    mBlockSize = length > cBlockSize ? length : cBlockSize;
+    mBlocks.emplace_back(new char[mBlockSize]);
+    mBlockUsed = 0;
+  }
+  char* copy = mBlocks.back().get() + mBlockUsed;
+  memcpy(copy, text, length);
+  mBlockUsed += length;
+  return copy;
+}
+
+void StringInterner::Grow()
+{
+  // Fill the new table before anyone can see it, then swap it in
+  const Table& old = *mTable.load(std::memory_order_relaxed);
+  mTables.emplace_back(new Table((old.mMask + 1) * 2));
+  Table& table = *mTables.back();
+  Atom count = mCount.load(std::memory_order_relaxed);
+  for (Atom atom = 1; atom < count; ++atom)
+  {
+    size_t slot = GetEntry(atom).mHash & table.mMask;
+    while (table.mSlots[slot].load(std::memory_order_relaxed) != cInvalidAtom)
+      slot = (slot + 1) & table.mMask;
+    table.mSlots[slot].store(atom, std::memory_order_relaxed);
+  }
+  mTable.store(&table, std::memory_order_release);
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "../Drivers/Driver1.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// A 32-bit id standing for one distinct string (two names are equal exactly when their atoms are)
+typedef uint32_t Atom;
+// Never handed out, so it can mean "not interned"
+const Atom cInvalidAtom = 0;
+
+// Gives every distinct string an atom the first time it is seen and keeps a single copy of its text
+// Interned text lives (at the same address) as long as the interner, which for GetInstance is the whole process
+// Thread safe: any number of compilations can intern and look up at once. Lookups of strings that are already
+// interned never lock, and only adding a new string takes the mutex
+class StringInterner
+{
+public:
+  StringInterner();
+
+  StringInterner(const StringInterner&) = delete;
+  StringInterner& operator=(const StringInterner&) = delete;
+
+  static StringInterner& GetInstance();
+
+  // Throws a ParsingException once every atom has been handed out (the scanner interns every identifier it reads)
+  Atom Intern(const char* text, size_t length);
+  Atom Intern(const std::string& text)
+  {
+    return Intern(text.data(), text.size());
+  }
+  // The atom the scanner gave the token, or its text interned now (no string is built unless the text is new)
+  Atom Intern(const Token& token)
+  {
+    if (token.mTokenType == TokenType::Identifier && token.mAtom != cInvalidAtom)
+      return token.mAtom;
+    return Intern(token.mText, token.mLength);
+  }
+
+  // The atom of a string that was already interned, or cInvalidAtom (lookups never grow the interner)
+  Atom Find(const char* text, size_t length) const;
+  // Scanned identifiers already carry their atom, so this only hashes tokens made some other way
+  Atom Find(const Token& token) const
+  {
+    if (token.mTokenType == TokenType::Identifier && token.mAtom != cInvalidAtom)
+      return token.mAtom;
+    return Find(token.mText, token.mLength);
+  }
+
+  // The atom must have come from this interner
+  std::string_view GetText(Atom atom) const
+  {
+    const Entry& entry = GetEntry(atom);
+    return std::string_view(entry.mText, entry.mLength);
+  }
+
+  // The number of atoms handed out
+  size_t GetCount() const
+  {
+    return mCount.load(std::memory_order_acquire) - 1;
+  }
+
+private:
+  struct Entry
+  {
+    const char* mText;
+    uint32_t mLength;
+    uint32_t mHash;
+  };
+
+  // Open addressed slots holding atoms (cInvalidAtom marks an empty slot), a power of two in size
+  // A table is never resized: growing builds a bigger one and publishes it, and the old one stays readable
+  struct Table
+  {
+    explicit Table(size_t size);
+
+    size_t mMask;
+    std::unique_ptr<std::atomic<Atom>[]> mSlots;
+  };
+
+  // Entries are kept in fixed size chunks that never move, so readers can use them while atoms are added
+  static const size_t cChunkBits = 12;
+  static const size_t cChunkSize = (size_t)1 << cChunkBits;
+  static const size_t cMaxChunks = 16 * 1024;
+  static const size_t cBlockSize = 16 * 1024;
+
+  static uint32_t Hash(const char* text, size_t length);
+
+  const Entry& GetEntry(Atom atom) const
+  {
+    return mChunks[atom >> cChunkBits].load(std::memory_order_acquire)[atom & (cChunkSize - 1)];
+  }
+
+  // The atom in the table with the text, or cInvalidAtom with the empty slot it would go in
+  Atom Probe(const Table& table, const char* text, size_t length, uint32_t hash, size_t* emptySlot) const;
+  // The mutex must be held for the rest
+  const char* CopyText(const char* text, size_t length);
+  void Grow();
+
+  std::atomic<const Table*> mTable;
+  std::unique_ptr<std::atomic<Entry*>[]> mChunks;
+  // One more than the last atom handed out (entry 0 is cInvalidAtom)
+  std::atomic<uint32_t> mCount;
+
+  std::mutex mMutex;
+  // Every table made so far (the replaced ones may still be in use by a lookup that started before the swap)
+  std::vector<std::unique_ptr<Table>> mTables;
+  std::vector<std::unique_ptr<Entry[]>> mOwnedChunks;
+  // The interned text, allocated in blocks so it never moves
+  std::vector<std::unique_ptr<char[]>> mBlocks;
+  size_t mBlockUsed;
+  size_t mBlockSize;
+};
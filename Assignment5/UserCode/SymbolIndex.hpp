@@ -0,0 +1,63 @@
+#pragma once
+
+#include "../Drivers/Driver4.hpp"
+
+#include "IdMap.hpp"
+#include "StringInterner.hpp"
+
+// Atom keyed copies of the library's globals and every class's members, kept next to the string keyed maps
+// the library and types expose (which stay filled in for everything outside of semantic analysis)
+// The passes look names up here with the atom the scanner stored on each identifier, so a lookup only compares integers
+class SymbolIndex
+{
+public:
+  // Indexes every global the library has so far (a later global with the same name replaces an earlier one,
+  // just like in Library::mGlobalsByName)
+  void AddGlobals(Library* library)
+  {
+    for (Symbol* symbol : library->mGlobals)
+    {
+      Atom name = StringInterner::GetInstance().Intern(symbol->mName);
+      if (!mGlobals.Insert(name, symbol))
+        *mGlobals.Find(name) = symbol;
+    }
+  }
+
+  Symbol* FindGlobal(const Token& name)
+  {
+    Atom atom = StringInterner::GetInstance().Find(name);
+    Symbol** symbol = atom != cInvalidAtom ? mGlobals.Find(atom) : nullptr;
+    return symbol != nullptr ? *symbol : nullptr;
+  }
+
+  // Returns false (keeping the first member) if the type already has a member with the symbol's name
+  bool AddMember(Type* type, Symbol* member)
+  {
+    return GetMembers(type).Insert(StringInterner::GetInstance().Intern(member->mName), member);
+  }
+
+  Symbol* FindMember(Type* type, const Token& name)
+  {
+    size_t* index = mMemberTables.Find((uint64_t)(uintptr_t)type);
+    Atom atom = StringInterner::GetInstance().Find(name);
+    if (index == nullptr || atom == cInvalidAtom)
+      return nullptr;
+    Symbol** symbol = mMembers[*index].Find(atom);
+    return symbol != nullptr ? *symbol : nullptr;
+  }
+
+private:
+  IdMap<Symbol*>& GetMembers(Type* type)
+  {
+    mMemberTables.Insert((uint64_t)(uintptr_t)type, mMembers.size());
+    size_t index = *mMemberTables.Find((uint64_t)(uintptr_t)type);
+    if (index == mMembers.size())
+      mMembers.emplace_back();
+    return mMembers[index];
+  }
+
+  IdMap<Symbol*> mGlobals;
+  // Each type's members, found through the type's address
+  IdMap<size_t> mMemberTables;
+  std::vector<IdMap<Symbol*>> mMembers;
+};
@@ -2,6 +2,7 @@
 
 #include "Visitor.hpp"
 #include "../Drivers/Driver4.hpp"
+#include "Tracing.hpp"
 
 class SymbolPrinterVisitor : public Visitor
 {
@@ -34,7 +35,7 @@ public:
 
   #define DeclareNodeVisit(NodeType) virtual VisitResult Visit(NodeType* node)\
 {\
-  NodePrinter printer;                                        \
+  TreePrinter printer;                                        \
     printer << #NodeType;\
     PrintValues(printer, node);\
     node->Walk(this, false);                                    \
@@ -44,7 +45,7 @@ public:
 
 #define PrintNode0(NodeType) virtual VisitResult Visit(NodeType* node)\
 {\
-  NodePrinter printer;                                        \
+  TreePrinter printer;                                        \
     printer << #NodeType;\
     node->Walk(this, false);                                    \
     return VisitResult::Stop;\
@@ -52,7 +53,7 @@ public:
 
 #define PrintNode1(NodeType, Arg1) virtual VisitResult Visit(NodeType* node)\
 {\
-  NodePrinter printer;                                        \
+  TreePrinter printer;                                        \
     printer << #NodeType;\
     printer << "(" << node->Arg1 << ")";\
     node->Walk(this, false);                                    \
@@ -62,7 +63,7 @@ public:
 
 #define PrintNode2(NodeType, Arg1, Arg2) virtual VisitResult Visit(NodeType* node)\
 {\
-  NodePrinter printer;                                        \
+  TreePrinter printer;                                        \
     printer << #NodeType;\
     printer << "(" << node->Arg1 << ", " << node->Arg2 << ")";\
     node->Walk(this, false);                                    \
@@ -72,7 +73,7 @@ public:
 
 #define PrintNode3(NodeType, Arg1, Arg2, Arg3) virtual VisitResult Visit(NodeType* node)\
 {\
-  NodePrinter printer;                                        \
+  TreePrinter printer;                                        \
     printer << #NodeType;\
     printer << "(" << node->Arg1 << ", " << node->Arg2 << ", " << node->Arg3 << ")";\
     node->Walk(this, false);                                    \
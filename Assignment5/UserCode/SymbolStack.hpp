@@ -2,6 +2,10 @@
 
 #include "../Drivers/Driver4.hpp"
 
+#include "IdMap.hpp"
+#include "StringInterner.hpp"
+
+// Scopes of symbols keyed by the atom of their name, so resolving a name compares integers instead of strings
 class SymbolStack
 {
 public:
@@ -10,22 +14,21 @@ public:
   public:
     void Add(Symbol* symbol)
     {
-      Add(symbol->mName, symbol);
+      Add(StringInterner::GetInstance().Intern(symbol->mName), symbol);
     }
 
-    void Add(const std::string& name, Symbol* symbol)
+    // The first symbol added with a name wins
+    void Add(Atom name, Symbol* symbol)
     {
-      mSymbols.insert(std::make_pair(name, symbol));
+      mSymbols.Insert(name, symbol);
     }
 
-    Symbol* Find(const std::string& name)
+    Symbol* Find(Atom name)
     {
-      auto&& it = mSymbols.find(name);
-      if (it != mSymbols.end())
-        return it->second;
-      return nullptr;
+      Symbol** symbol = mSymbols.Find(name);
+      return symbol != nullptr ? *symbol : nullptr;
     }
-    std::unordered_map<std::string, Symbol*> mSymbols;
+    IdMap<Symbol*> mSymbols;
   };
 
   SymbolStack()
@@ -45,15 +48,15 @@ public:
 
   void Add(Symbol* symbol)
   {
-    Add(symbol->mName, symbol);
+    mSymbols.back().Add(symbol);
   }
 
   void Add(const std::string& name, Symbol* symbol)
   {
-    mSymbols.back().Add(name, symbol);
+    mSymbols.back().Add(StringInterner::GetInstance().Intern(name), symbol);
   }
 
-  Symbol* Find(const std::string& name)
+  Symbol* Find(Atom name)
   {
     for (size_t i = 0; i < mSymbols.size(); ++i)
     {
@@ -65,5 +68,18 @@ public:
     return nullptr;
   }
 
+  // A name that was never interned can't belong to any symbol
+  Symbol* Find(const Token& name)
+  {
+    Atom atom = StringInterner::GetInstance().Find(name);
+    return atom != cInvalidAtom ? Find(atom) : nullptr;
+  }
+
+  Symbol* Find(const std::string& name)
+  {
+    Atom atom = StringInterner::GetInstance().Find(name.data(), name.size());
+    return atom != cInvalidAtom ? Find(atom) : nullptr;
+  }
+
   std::vector<SymbolTable> mSymbols;
-};
\ No newline at end of file
+};
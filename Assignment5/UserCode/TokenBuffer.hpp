@@ -0,0 +1,180 @@
+#pragma once
+
+#include "../Drivers/Driver1.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// A handle to a token inside a TokenBuffer (4 bytes instead of a 24 byte Token)
+// The AST nodes still hold full Tokens: the drivers parse from a std::vector<Token>, so there is no buffer for an id
+// to point into, and driver code reads node tokens as Token (Driver4's error messages). FlatAst is the form that keeps ids
+class TokenId
+{
+public:
+  static const uint32_t cInvalidIndex = 0xFFFFFFFF;
+
+  TokenId() :
+    mIndex(cInvalidIndex)
+  {
+  }
+
+  explicit TokenId(uint32_t index) :
+    mIndex(index)
+  {
+  }
+
+  bool IsValid() const
+  {
+    return mIndex != cInvalidIndex;
+  }
+
+  uint32_t mIndex;
+};
+
+// Every token of a source text stored as separate arrays: a 32-bit offset into the text, a 16-bit length and an 8-bit type
+// That is 7 bytes per token, and the parser's scans over token types only touch the type array
+// Lengths that don't fit in 16 bits (long comments or strings) are marked and kept on the side
+class TokenBuffer
+{
+public:
+  static const uint16_t cLongLength = 0xFFFF;
+  static const size_t cMaxOffset = 0xFFFFFFFF;
+
+  // The text must outlive the buffer
+  explicit TokenBuffer(const char* text) :
+    mText(text)
+  {
+  }
+
+  // Returns false if the token can't be stored (the text is larger than 4GB)
+  bool Add(size_t offset, size_t length, int tokenType)
+  {
+    if (offset > cMaxOffset || length > cMaxOffset)
+      return false;
+
+    if (length >= cLongLength)
+    {
+      mLongLengths.push_back(std::make_pair((uint32_t)mOffsets.size(), (uint32_t)length));
+      mLengths.push_back(uint16_t(cLongLength));
+    }
+    else
+    {
+      mLengths.push_back((uint16_t)length);
+    }
+    mOffsets.push_back((uint32_t)offset);
+    mTypes.push_back((uint8_t)tokenType);
+    return true;
+  }
+
+  void Clear()
+  {
+    mOffsets.clear();
+    mLengths.clear();
+    mTypes.clear();
+    mLongLengths.clear();
+    mMaxLookahead = 0;
+  }
+
+  // Replaces the tokens [first, last) with all of the tokens in the replacement (whose offsets must already be final)
+  // and moves every token after them by offsetShift (used when the text was edited)
+  void Splice(size_t first, size_t last, const TokenBuffer& replacement, int64_t offsetShift)
+  {
+    size_t count = replacement.GetCount();
+    if (offsetShift != 0)
+    {
+      for (size_t i = last; i < mOffsets.size(); ++i)
+        mOffsets[i] = (uint32_t)(mOffsets[i] + offsetShift);
+    }
+
+    // Most edits (like typing inside an identifier) keep the same number of tokens, so nothing needs to move
+    if (count == last - first)
+    {
+      std::copy(replacement.mOffsets.begin(), replacement.mOffsets.end(), mOffsets.begin() + first);
+      std::copy(replacement.mLengths.begin(), replacement.mLengths.end(), mLengths.begin() + first);
+      std::copy(replacement.mTypes.begin(), replacement.mTypes.end(), mTypes.begin() + first);
+    }
+    else
+    {
+      mOffsets.erase(mOffsets.begin() + first, mOffsets.begin() + last);
+      mOffsets.insert(mOffsets.begin() + first, replacement.mOffsets.begin(), replacement.mOffsets.end());
+      mLengths.erase(mLengths.begin() + first, mLengths.begin() + last);
+      mLengths.insert(mLengths.begin() + first, replacement.mLengths.begin(), replacement.mLengths.end());
+      mTypes.erase(mTypes.begin() + first, mTypes.begin() + last);
+      mTypes.insert(mTypes.begin() + first, replacement.mTypes.begin(), replacement.mTypes.end());
+    }
+
+    // Long lengths are rare, so just rebuild their (sorted) list
+    std::vector<std::pair<uint32_t, uint32_t>> longLengths;
+    for (auto&& pair : mLongLengths)
+    {
+      if (pair.first < first)
+        longLengths.push_back(pair);
+    }
+    for (auto&& pair : replacement.mLongLengths)
+      longLengths.push_back(std::make_pair((uint32_t)(pair.first + first), pair.second));
+    for (auto&& pair : mLongLengths)
+    {
+      if (pair.first >= last)
+        longLengths.push_back(std::make_pair((uint32_t)(pair.first - last + first + count), pair.second));
+    }
+    mLongLengths = std::move(longLengths);
+  }
+
+  size_t GetCount() const
+  {
+    return mTypes.size();
+  }
+
+  int GetType(TokenId id) const
+  {
+    return mTypes[id.mIndex];
+  }
+
+  size_t GetOffset(TokenId id) const
+  {
+    return mOffsets[id.mIndex];
+  }
+
+  size_t GetLength(TokenId id) const
+  {
+    uint16_t length = mLengths[id.mIndex];
+    if (length != cLongLength)
+      return length;
+
+    // Long lengths are added in token order, so they are sorted by index
+    auto it = std::lower_bound(mLongLengths.begin(), mLongLengths.end(), std::make_pair(id.mIndex, (uint32_t)0));
+    return it->second;
+  }
+
+  const char* GetText(TokenId id) const
+  {
+    return mText + mOffsets[id.mIndex];
+  }
+
+  // Rebuilds the full token (for code that still works with Token, such as the AST nodes)
+  Token GetToken(TokenId id) const
+  {
+    return Token(GetText(id), GetLength(id), GetType(id));
+  }
+
+  // The memory used by the arrays (not counting unused capacity)
+  size_t GetSizeInBytes() const
+  {
+    return mOffsets.size() * sizeof(uint32_t) + mLengths.size() * sizeof(uint16_t) + mTypes.size() * sizeof(uint8_t) +
+      mLongLengths.size() * sizeof(std::pair<uint32_t, uint32_t>);
+  }
+
+  const char* mText;
+  std::vector<uint32_t> mOffsets;
+  std::vector<uint16_t> mLengths;
+  std::vector<uint8_t> mTypes;
+  // The token index and real length of every token whose length is cLongLength
+  std::vector<std::pair<uint32_t, uint32_t>> mLongLengths;
+  // The furthest any read went past the end of its token (see ReadTableToken), which bounds how far
+  // back an edit can change the tokens in front of it
+  size_t mMaxLookahead = 0;
+};
+
+static_assert(TokenType::EnumCount <= 0xFF, "Token types must fit in the 8-bit type array of the TokenBuffer");
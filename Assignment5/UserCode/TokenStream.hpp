@@ -0,0 +1,68 @@
+#pragma once
+
+#include "../Drivers/Driver1.hpp"
+
+// A cursor that reads tokens from the language DFA on demand, one token ahead of the consumer
+// Whitespace and comments are dropped as they are scanned, so only the current token is ever held in memory
+// (instead of a vector of every token in the file, see TokenizeAndDeleteRoot and RemoveWhitespaceAndComments)
+// Characters that no rule accepts are skipped one at a time, the same way TokenizeAndDeleteRoot skips them
+class TokenStream
+{
+public:
+  // The root must be the language DFA (see CreateLanguageDfa) and must outlive the stream, as must the text
+  TokenStream(DfaState* root, const char* stream) :
+    mRoot(root),
+    mStream(stream)
+  {
+    ReadNext();
+  }
+
+  // The next token, only valid if IsAtEnd is false
+  const Token& Peek() const
+  {
+    return mCurrent;
+  }
+
+  bool IsAtEnd() const
+  {
+    return mAtEnd;
+  }
+
+  void Advance()
+  {
+    if (!mAtEnd)
+      ReadNext();
+  }
+
+  static bool IsTrivia(int tokenType)
+  {
+    return tokenType == TokenType::Whitespace || tokenType == TokenType::SingleLineComment || tokenType == TokenType::MultiLineComment;
+  }
+
+private:
+  void ReadNext()
+  {
+    while (*mStream != '\0')
+    {
+      mCurrent = Token();
+      ReadLanguageToken(mRoot, mStream, mCurrent);
+      if (mCurrent.mLength == 0)
+      {
+        ++mStream;
+        continue;
+      }
+
+      mStream += mCurrent.mLength;
+      if (!IsTrivia(mCurrent.mTokenType))
+        return;
+    }
+
+    mCurrent = Token();
+    mAtEnd = true;
+  }
+
+  DfaState* mRoot;
+  const char* mStream;
+  Token mCurrent;
+  bool mAtEnd = false;
+};
@@ -0,0 +1,324 @@
+/******************************************************************\
+ * Author:
+ * Copyright 2015, DigiPen Institute of Technology
+\******************************************************************/
+#include "../Drivers/Driver1.hpp"
+
+#include <algorithm>
+#include <string.h>
+#include <thread>
+#include <unordered_map>
+#include "Dfa.hpp"
+#include "Tokenizer.hpp"
+#include "TokenStream.hpp"
+
+// Outputs a token and moves past it, the same way TokenizeAndDeleteRoot does
+static size_t AdvanceToken(const Token& token, std::vector<Token>& tokensOut)
+{
+  if (token.mLength == 0)
+    return 1;
+  tokensOut.push_back(token);
+  return token.mLength;
+}
+
+void TokenizeStream(const DfaTable& table, const char* stream, std::vector<Token>& tokensOut)
+{
+  while (*stream != '\0')
+  {
+    Token token;
+    ReadTableToken(table, stream, token);
+    stream += AdvanceToken(token, tokensOut);
+  }
+}
+
+size_t ReadTableTokenSkippingTrivia(const DfaTable& table, const char* stream, Token& outToken, std::vector<Token>* triviaOut)
+{
+  size_t offset = 0;
+  while (stream[offset] != '\0')
+  {
+    Token token;
+    ReadTableToken(table, stream + offset, token);
+    if (token.mLength == 0)
+    {
+      ++offset;
+      continue;
+    }
+
+    if (!TokenStream::IsTrivia(token.mTokenType))
+    {
+      outToken = token;
+      return offset;
+    }
+    if (triviaOut != nullptr)
+      triviaOut->push_back(token);
+    offset += token.mLength;
+  }
+
+  outToken = Token();
+  outToken.mText = stream + offset;
+  return offset;
+}
+
+void TokenizeStreamSkippingTrivia(const DfaTable& table, const char* stream, std::vector<Token>& tokensOut, std::vector<Token>* triviaOut)
+{
+  for (;;)
+  {
+    Token token;
+    stream += ReadTableTokenSkippingTrivia(table, stream, token, triviaOut);
+    if (token.mLength == 0)
+      return;
+    tokensOut.push_back(token);
+    stream += token.mLength;
+  }
+}
+
+bool TokenizeStream(const DfaTable& table, const char* stream, TokenBuffer& bufferOut, bool skipTrivia)
+{
+  size_t offset = 0;
+  while (stream[offset] != '\0')
+  {
+    Token token;
+    size_t scanned = ReadTableToken(table, stream + offset, token);
+    bufferOut.mMaxLookahead = std::max(bufferOut.mMaxLookahead, scanned - token.mLength);
+    if (token.mLength == 0)
+    {
+      ++offset;
+      continue;
+    }
+
+    if (!(skipTrivia && TokenStream::IsTrivia(token.mTokenType)) && !bufferOut.Add(offset, token.mLength, token.mTokenType))
+      return false;
+    offset += token.mLength;
+  }
+  return true;
+}
+
+bool RetokenizeEdit(const DfaTable& table, const char* newText, const TokenEdit& edit, TokenBuffer& buffer, bool skipTrivia)
+{
+  // A read looks at most mMaxLookahead + 1 characters past the end of its token, so every token that ends
+  // far enough before the edit is unchanged. Rescanning starts right after the last of them (the start of a read)
+  size_t keepCount = 0;
+  size_t position = 0;
+  {
+    size_t low = 0;
+    size_t high = buffer.GetCount();
+    while (low < high)
+    {
+      size_t middle = (low + high) / 2;
+      TokenId id((uint32_t)middle);
+      if (buffer.GetOffset(id) + buffer.GetLength(id) + buffer.mMaxLookahead < edit.mOffset)
+        low = middle + 1;
+      else
+        high = middle;
+    }
+    keepCount = low;
+    if (keepCount != 0)
+    {
+      TokenId last((uint32_t)(keepCount - 1));
+      position = buffer.GetOffset(last) + buffer.GetLength(last);
+    }
+  }
+
+  int64_t shift = (int64_t)edit.mInsertedLength - (int64_t)edit.mRemovedLength;
+  size_t resyncOffset = edit.mOffset + edit.mInsertedLength;
+  size_t resyncIndex = buffer.GetCount();
+  size_t maxLookahead = buffer.mMaxLookahead;
+  TokenBuffer rescanned(newText);
+  while (newText[position] != '\0')
+  {
+    // Past the edit, a read starting where an old read started produces the old tokens from there on
+    if (position >= resyncOffset)
+    {
+      uint32_t oldPosition = (uint32_t)(position - shift);
+      auto it = std::lower_bound(buffer.mOffsets.begin() + keepCount, buffer.mOffsets.end(), oldPosition);
+      if (it != buffer.mOffsets.end() && *it == oldPosition)
+      {
+        resyncIndex = (size_t)(it - buffer.mOffsets.begin());
+        break;
+      }
+    }
+
+    Token token;
+    size_t scanned = ReadTableToken(table, newText + position, token);
+    maxLookahead = std::max(maxLookahead, scanned - token.mLength);
+    if (token.mLength == 0)
+    {
+      ++position;
+      continue;
+    }
+
+    if (!(skipTrivia && TokenStream::IsTrivia(token.mTokenType)) && !rescanned.Add(position, token.mLength, token.mTokenType))
+      return false;
+    position += token.mLength;
+  }
+
+  buffer.Splice(keepCount, resyncIndex, rescanned, shift);
+  buffer.mText = newText;
+  buffer.mMaxLookahead = maxLookahead;
+  return true;
+}
+
+void TokenizeStreamLinear(const DfaTable& table, const char* stream, std::vector<Token>& tokensOut)
+{
+  const uint8_t* byteClasses = table.mByteClasses;
+  const uint16_t* transitions = table.mTransitions;
+  const int* acceptingTokens = table.mAcceptingTokens;
+  size_t classCount = table.mClassCount;
+  uint64_t stateCount = table.mStateCount;
+
+  // Every (state, position) pair that never reaches another accepting state, mapped to the position where the automaton dies
+  std::unordered_map<uint64_t, size_t> failedPairs;
+  // The pairs visited since the last accepting state of the current token
+  std::vector<uint64_t> trail;
+  // No pair past this position has been visited yet, so there is nothing to look up there
+  size_t furthestIndex = 0;
+
+  size_t start = 0;
+  while (stream[start] != '\0')
+  {
+    size_t state = DfaTable::cStartState;
+    size_t index = start;
+    size_t acceptedIndex = start;
+    size_t deadIndex = start;
+    int acceptedToken = 0;
+    trail.clear();
+
+    for (;;)
+    {
+      if (stream[index] == '\0')
+      {
+        deadIndex = index;
+        break;
+      }
+
+      uint64_t pair = index * stateCount + state;
+      if (index <= furthestIndex)
+      {
+        auto it = failedPairs.find(pair);
+        if (it != failedPairs.end())
+        {
+          deadIndex = it->second;
+          break;
+        }
+      }
+      trail.push_back(pair);
+
+      state = transitions[state * classCount + byteClasses[(unsigned char)stream[index]]];
+      if (state == DfaTable::cDeadState)
+      {
+        deadIndex = index;
+        break;
+      }
+
+      ++index;
+      if (acceptingTokens[state] != 0)
+      {
+        acceptedToken = acceptingTokens[state];
+        acceptedIndex = index;
+        trail.clear();
+      }
+    }
+
+    if (index > furthestIndex)
+      furthestIndex = index;
+    for (uint64_t pair : trail)
+      failedPairs[pair] = deadIndex;
+
+    Token token(stream + start, deadIndex - start, TokenType::Invalid);
+    if (acceptedToken != 0)
+    {
+      token.mTokenType = acceptedToken;
+      token.mLength = acceptedIndex - start;
+    }
+    start += AdvanceToken(token, tokensOut);
+  }
+}
+
+// Every token read speculatively from the start of a chunk, including the zero length reads that skip
+// a character, so that any position a read started at can be found again while stitching
+class TokenChunk
+{
+public:
+  size_t mBegin = 0;
+  size_t mEnd = 0;
+  std::vector<Token> mReads;
+};
+
+static void TokenizeChunk(const DfaTable& table, const char* stream, TokenChunk& chunk)
+{
+  size_t offset = chunk.mBegin;
+  while (offset < chunk.mEnd)
+  {
+    Token token;
+    ReadTableToken(table, stream + offset, token);
+    chunk.mReads.push_back(token);
+    offset += token.mLength == 0 ? 1 : token.mLength;
+  }
+}
+
+// A chunk needs enough work to be worth a thread
+static const size_t cMinParallelChunkSize = 64 * 1024;
+
+void TokenizeStreamParallel(const DfaTable& table, const char* stream, std::vector<Token>& tokensOut, size_t threadCount)
+{
+  size_t length = strlen(stream);
+  if (threadCount == 0)
+    threadCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+  threadCount = std::min(threadCount, length / cMinParallelChunkSize);
+  if (threadCount <= 1)
+  {
+    TokenizeStream(table, stream, tokensOut);
+    return;
+  }
+
+  // Move each boundary to the start of a line, where a token is most likely to start
+  std::vector<TokenChunk> chunks(threadCount);
+  for (size_t i = 0; i < threadCount; ++i)
+  {
+    size_t begin = i == 0 ? 0 : chunks[i - 1].mEnd;
+    size_t end = length * (i + 1) / threadCount;
+    const char* newline = (const char*)memchr(stream + end, '\n', length - end);
+    end = newline != nullptr && i + 1 < threadCount ? (size_t)(newline - stream) + 1 : length;
+    chunks[i].mBegin = std::min(begin, length);
+    chunks[i].mEnd = std::max(end, chunks[i].mBegin);
+  }
+
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < threadCount; ++i)
+    threads.emplace_back(TokenizeChunk, std::cref(table), stream, std::ref(chunks[i]));
+  TokenizeChunk(table, stream, chunks[0]);
+  for (std::thread& thread : threads)
+    thread.join();
+
+  size_t readCount = 0;
+  for (TokenChunk& chunk : chunks)
+    readCount += chunk.mReads.size();
+  tokensOut.reserve(tokensOut.size() + readCount);
+
+  // Walk the real token boundaries through each chunk until they meet a read the chunk also made
+  size_t offset = 0;
+  for (TokenChunk& chunk : chunks)
+  {
+    while (offset < chunk.mEnd)
+    {
+      const char* position = stream + offset;
+      auto it = std::lower_bound(chunk.mReads.begin(), chunk.mReads.end(), position,
+        [](const Token& token, const char* text) { return token.mText < text; });
+      if (it != chunk.mReads.end() && it->mText == position)
+      {
+        for (; it != chunk.mReads.end(); ++it)
+        {
+          if (it->mLength != 0)
+            tokensOut.push_back(*it);
+        }
+        const Token& last = chunk.mReads.back();
+        offset = (size_t)(last.mText - stream) + (last.mLength == 0 ? 1 : last.mLength);
+        break;
+      }
+
+      Token token;
+      ReadTableToken(table, position, token);
+      offset += AdvanceToken(token, tokensOut);
+    }
+  }
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "../Drivers/Driver1.hpp"
+#include "Dfa.hpp"
+#include "TokenBuffer.hpp"
+
+#include <vector>
+
+// Tokenizes an entire stream exactly like the drivers do with repeated ReadToken calls (see TokenizeAndDeleteRoot)
+// Each token is read with maximal munch. Tokens of length 0 skip one character and are not output, while
+// invalid tokens that consumed input are output with the Invalid type
+void TokenizeStream(const DfaTable& table, const char* stream, std::vector<Token>& tokensOut);
+
+// Reads the next token that isn't whitespace or a comment: whenever the token read is trivia the automaton starts over
+// from the start state right after it, so trivia is never handed back. Returns how far into the stream the token starts
+// (with an empty token at the null terminator if only trivia was left). Skipped trivia is appended to triviaOut when set
+size_t ReadTableTokenSkippingTrivia(const DfaTable& table, const char* stream, Token& outToken, std::vector<Token>* triviaOut);
+
+// Tokenizes a stream like TokenizeStream followed by RemoveWhitespaceAndComments, without ever storing the trivia
+// (or only storing it in triviaOut, for tools that need the whitespace and comments, when that is set)
+void TokenizeStreamSkippingTrivia(const DfaTable& table, const char* stream, std::vector<Token>& tokensOut, std::vector<Token>* triviaOut = nullptr);
+
+// The same as above, but storing the tokens compactly (the buffer's text must be the stream)
+// Whitespace and comments are left out when skipTrivia is set (as if RemoveWhitespaceAndComments was called)
+// Returns false if the stream is too large for a TokenBuffer
+bool TokenizeStream(const DfaTable& table, const char* stream, TokenBuffer& bufferOut, bool skipTrivia);
+
+// An edit to a source text: removedLength characters at offset were replaced by insertedLength new characters
+class TokenEdit
+{
+public:
+  size_t mOffset = 0;
+  size_t mRemovedLength = 0;
+  size_t mInsertedLength = 0;
+};
+
+// Updates a buffer built by TokenizeStream for the text before an edit so it holds the tokens of the edited text
+// Only tokens that could have looked at the edited characters are rescanned (backing off by the buffer's maximum lookahead),
+// and scanning stops as soon as a read starts where an old token after the edit started, since everything from there on
+// is unchanged apart from its offset. The result is exactly what TokenizeStream produces for the new text
+// skipTrivia must match the TokenizeStream call that built the buffer. Returns false if the new text is too large
+bool RetokenizeEdit(const DfaTable& table, const char* newText, const TokenEdit& edit, TokenBuffer& buffer, bool skipTrivia);
+
+// Produces the same tokens as TokenizeStream, but in time linear to the length of the stream
+// Maximal munch scans past the last accepting state until the automaton dies, and the next token starts over from the
+// accepted position, so inputs like "/*a/*a/*a..." (an unterminated comment after every '/') rescan the rest of the
+// stream for every token. Following Reps ("Maximal-munch" tokenization in linear time), every (state, position) pair that
+// was scanned past the last accepting state is remembered together with where the automaton died, so no pair is scanned twice
+void TokenizeStreamLinear(const DfaTable& table, const char* stream, std::vector<Token>& tokensOut);
+
+// Produces the same tokens as TokenizeStream by splitting the stream into chunks (at line starts) and tokenizing
+// every chunk on its own thread as if a token started at the beginning of the chunk
+// Since a token read from a given position never depends on what came before it, once the real token boundaries
+// reach a position where the chunk also started a token, the rest of the chunk's tokens are exactly right
+// The chunks are stitched together in order, re-reading only the few tokens before that meeting point
+// (for example when a chunk starts in the middle of a comment or string)
+// A threadCount of 0 uses one thread per core, and small streams are tokenized on the calling thread
+void TokenizeStreamParallel(const DfaTable& table, const char* stream, std::vector<Token>& tokensOut, size_t threadCount);
@@ -0,0 +1,98 @@
+/******************************************************************\
+ * Author:
+ * Copyright 2015, DigiPen Institute of Technology
+\******************************************************************/
+#include "Tracing.hpp"
+
+#include <exception>
+
+std::vector<RuleTrace*> RuleTrace::sActiveRules;
+
+RuleTrace::RuleTrace(const char* rule) :
+  mName(nullptr),
+  mAccepted(false),
+  mExceptionCount(0)
+{
+  if (!GetDiagnosticSink().IsEnabled())
+    return;
+
+  mName = rule;
+  mExceptionCount = std::uncaught_exceptions();
+  AppendTabs(sActiveRules.size());
+  mText += rule;
+  mText += '\n';
+  sActiveRules.push_back(this);
+}
+
+RuleTrace::~RuleTrace()
+{
+  if (mName == nullptr)
+    return;
+  sActiveRules.pop_back();
+
+  // A rule left by an exception is printed with a '*'
+  bool failed = std::uncaught_exceptions() > mExceptionCount;
+  if (!mAccepted && !failed)
+    return;
+
+  AppendTabs(sActiveRules.size());
+  mText += "End";
+  mText += mName;
+  mText += failed ? "*\n" : "\n";
+
+  if (sActiveRules.empty())
+  {
+    mText += '\n';
+    GetDiagnosticSink().Write(mText);
+  }
+  else
+  {
+    sActiveRules.back()->mText += mText;
+  }
+}
+
+void RuleTrace::AcceptedToken(const Token& token)
+{
+  if (!GetDiagnosticSink().IsEnabled())
+    return;
+
+  if (sActiveRules.empty())
+  {
+    GetDiagnosticSink().Write(std::string("Accepting a token when we haven't entered a rule yet (construct a PrintRule on the stack)"));
+    return;
+  }
+
+  RuleTrace* rule = sActiveRules.back();
+  rule->AppendTabs(sActiveRules.size());
+  rule->mText += "Accepted: '";
+  rule->mText.append(token.mText, token.mLength);
+  rule->mText += "' (";
+  rule->mText += TokenNames[token.mTokenType];
+  rule->mText += ")\n";
+}
+
+void RuleTrace::AppendTabs(size_t depth)
+{
+  for (size_t i = 0; i < depth; ++i)
+    mText += "| ";
+}
+
+std::vector<TreePrinter*> TreePrinter::sActiveNodes;
+
+TreePrinter::TreePrinter()
+{
+  for (size_t i = 0; i < sActiveNodes.size(); ++i)
+    (*this) << "| ";
+
+  sActiveNodes.push_back(this);
+}
+
+TreePrinter::~TreePrinter()
+{
+  sActiveNodes.pop_back();
+
+  if (sActiveNodes.empty())
+    GetDiagnosticSink().Write(this->str() + "\n");
+  else
+    (*sActiveNodes.back()) << "\n" << this->str();
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "../Drivers/Driver1.hpp"
+
+#include <sstream>
+#include <string>
+#include <vector>
+#include "DiagnosticSink.hpp"
+
+// The parser's rule tracing: the same output as the driver's PrintRule, but written to the diagnostic sink
+// When the sink is disabled a rule only checks a flag (no text is built and nothing is recorded)
+class RuleTrace
+{
+public:
+  explicit RuleTrace(const char* rule);
+  ~RuleTrace();
+
+  RuleTrace(const RuleTrace&) = delete;
+  RuleTrace& operator=(const RuleTrace&) = delete;
+
+  // Marks the rule as accepted when the result is true, and passes the result through
+  template <typename T>
+  T Accept(T result)
+  {
+    if (result)
+      mAccepted = true;
+    return result;
+  }
+
+  bool Accept()
+  {
+    mAccepted = true;
+    return true;
+  }
+
+  // Called every time a token is accepted (within the latest rule)
+  static void AcceptedToken(const Token& token);
+
+private:
+  void AppendTabs(size_t depth);
+
+  static std::vector<RuleTrace*> sActiveRules;
+
+  // Null when tracing is disabled
+  const char* mName;
+  bool mAccepted;
+  int mExceptionCount;
+  std::string mText;
+};
+
+// The same as the driver's NodePrinter (a line of the tree per printer, tabbed by depth), but written to the diagnostic sink
+// Only used for printing, so callers check the sink is enabled before walking a tree with these
+class TreePrinter : public std::stringstream
+{
+public:
+  TreePrinter();
+  ~TreePrinter();
+
+private:
+  static std::vector<TreePrinter*> sActiveNodes;
+};
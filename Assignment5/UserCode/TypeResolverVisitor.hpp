@@ -2,15 +2,17 @@
 
 #include "Visitor.hpp"
 #include "LibraryHelpers.hpp"
+#include "SymbolIndex.hpp"
 #include "../Drivers/Driver4.hpp"
 
 class TypeResolverVisitor : public Visitor
 {
 public:
   
-  TypeResolverVisitor(Library* library)
+  TypeResolverVisitor(Library* library, SymbolIndex* symbolIndex)
   {
     mLibrary = library;
+    mSymbolIndex = symbolIndex;
   }
 
   virtual VisitResult Visit(BlockNode* node)
@@ -96,14 +98,14 @@ public:
 
   virtual VisitResult Visit(NamedTypeNode* node)
   {
-    const std::string typeName = node->mName.str();
-    node->mSymbol = LibraryHelpers::FindGlobalSymbolByName<Type>(mLibrary, typeName);
+    node->mSymbol = static_cast<Type*>(mSymbolIndex->FindGlobal(node->mName));
     if (node->mSymbol == nullptr)
-      ErrorSymbolNotFound(typeName);
+      ErrorSymbolNotFound(node->mName.str());
     return VisitResult::Stop;
   }
 
   Library* mLibrary = nullptr;
+  SymbolIndex* mSymbolIndex = nullptr;
   BlockNode* mBlock = nullptr;
   ClassNode* mClass = nullptr;
   FunctionNode* mFunction = nullptr;
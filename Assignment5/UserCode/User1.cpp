@@ -5,10 +5,17 @@
 #include "../Drivers/Driver1.hpp"
 
 #include <unordered_map>
+#include <unordered_set>
 #include <array>
+#include <algorithm>
 #include "../Drivers/AstNodes.hpp"
-
-const char cDefaultEdgeId = -1;
+#include "Dfa.hpp"
+#include "LanguageRules.hpp"
+#include "LanguageScanner.hpp"
+#include "Literals.hpp"
+#include "ScannerGenerator.hpp"
+#include "StaticDfa.hpp"
+#include "StringInterner.hpp"
 
 class MyClass
 {
@@ -33,25 +40,6 @@ class MyClass
   }
 };
 
-class DfaState
-{
-public:
-  int mAcceptingToken = 0;
-  std::unordered_map<char, DfaState*> mEdges;
-  bool mValid = true;
-
-  DfaState* Find(char value)
-  {
-    auto it = mEdges.find(value);
-    if (it == mEdges.end())
-      it = mEdges.find(cDefaultEdgeId);
-
-    if (it == mEdges.end())
-      return nullptr;
-    return it->second;
-  }
-};
-
 DfaState* AddState(int acceptingToken)
 {
   DfaState* result = new DfaState();
@@ -69,8 +57,328 @@ void AddDefaultEdge(DfaState* from, DfaState* to)
   from->mEdges[cDefaultEdgeId] = to;
 }
 
+// Numbers every state reachable from a root and resolves each state's transitions for all bytes
+class DfaLayout
+{
+public:
+  bool Build(DfaState* root)
+  {
+    // Number every reachable state in breadth first order (0 is reserved for the dead state)
+    mStates.push_back(nullptr);
+    mStates.push_back(root);
+    mIds[root] = DfaTable::cStartState;
+    for (size_t i = DfaTable::cStartState; i < mStates.size(); ++i)
+    {
+      for (auto&& pair : mStates[i]->mEdges)
+      {
+        if (mIds.find(pair.second) != mIds.end())
+          continue;
+        if (mStates.size() >= DfaTable::cMaxStates)
+          return false;
+        mIds[pair.second] = (uint16_t)mStates.size();
+        mStates.push_back(pair.second);
+      }
+    }
+
+    // Resolve every byte of every state through Find so that default edges are folded in
+    mRows.resize(mStates.size() * DfaTable::cAlphabetSize, uint16_t(DfaTable::cDeadState));
+    for (size_t i = DfaTable::cStartState; i < mStates.size(); ++i)
+    {
+      uint16_t* row = &mRows[i * DfaTable::cAlphabetSize];
+      for (size_t c = 0; c < DfaTable::cAlphabetSize; ++c)
+      {
+        DfaState* next = mStates[i]->Find((char)c);
+        if (next != nullptr)
+          row[c] = mIds[next];
+      }
+    }
+
+    // Partition the alphabet: start with every byte in one class and split a class
+    // whenever some state sends two of its bytes to different places
+    mClassCount = 1;
+    for (size_t i = DfaTable::cStartState; i < mStates.size(); ++i)
+    {
+      std::unordered_map<uint32_t, uint8_t> splitClasses;
+      uint8_t splitBytes[DfaTable::cAlphabetSize];
+      for (size_t c = 0; c < DfaTable::cAlphabetSize; ++c)
+      {
+        uint32_t key = ((uint32_t)mByteClasses[c] << 16) | Next(i, c);
+        auto result = splitClasses.insert(std::make_pair(key, (uint8_t)splitClasses.size()));
+        splitBytes[c] = result.first->second;
+      }
+      std::copy(splitBytes, splitBytes + DfaTable::cAlphabetSize, mByteClasses);
+      mClassCount = splitClasses.size();
+    }
+
+    // Remember one byte from each class so we can look up a class's transition
+    for (size_t c = DfaTable::cAlphabetSize; c-- > 0;)
+      mClassBytes[mByteClasses[c]] = (uint8_t)c;
+    return true;
+  }
+
+  uint16_t Next(size_t state, size_t byte) const
+  {
+    return mRows[state * DfaTable::cAlphabetSize + byte];
+  }
+
+  uint16_t NextForClass(size_t state, size_t byteClass) const
+  {
+    return Next(state, mClassBytes[byteClass]);
+  }
+
+  std::vector<DfaState*> mStates;
+  std::unordered_map<DfaState*, uint16_t> mIds;
+  // mStates.size() rows of DfaTable::cAlphabetSize entries
+  std::vector<uint16_t> mRows;
+  size_t mClassCount = 0;
+  uint8_t mByteClasses[DfaTable::cAlphabetSize] = {};
+  uint8_t mClassBytes[DfaTable::cAlphabetSize] = {};
+};
+
+bool CompileDfa(DfaState* root)
+{
+  DfaLayout layout;
+  if (!layout.Build(root))
+    return false;
+
+  size_t stateCount = layout.mStates.size();
+  auto table = std::make_unique<CompiledDfaTable>(stateCount, layout.mClassCount);
+  std::copy(layout.mByteClasses, layout.mByteClasses + DfaTable::cAlphabetSize, table->mByteClassStorage);
+  for (size_t i = DfaTable::cStartState; i < stateCount; ++i)
+  {
+    table->mAcceptingTokenStorage[i] = layout.mStates[i]->mAcceptingToken;
+    for (size_t c = 0; c < table->mClassCount; ++c)
+      table->mTransitionStorage[i * table->mClassCount + c] = layout.NextForClass(i, c);
+    table->mLoopStorage[i] = FindDfaLoop(&table->mTransitionStorage[i * table->mClassCount], table->mClassCount,
+      table->mByteClassStorage, (uint16_t)i);
+  }
+
+  root->mTable = table.get();
+  root->mOwnedTable = std::move(table);
+  return true;
+}
+
+DfaStatistics GetDfaStatistics(DfaState* root)
+{
+  DfaStatistics statistics;
+  std::unordered_map<DfaState*, bool> visited;
+  std::vector<DfaState*> stack;
+  stack.push_back(root);
+  visited[root] = true;
+  while (!stack.empty())
+  {
+    DfaState* state = stack.back();
+    stack.pop_back();
+    ++statistics.mStateCount;
+    statistics.mEdgeCount += state->mEdges.size();
+    for (auto&& pair : state->mEdges)
+    {
+      if (visited.insert(std::make_pair(pair.second, true)).second)
+        stack.push_back(pair.second);
+    }
+  }
+  return statistics;
+}
+
+DfaMinimizeReport MinimizeDfa(DfaState* root)
+{
+  DfaMinimizeReport report;
+  report.mBefore = GetDfaStatistics(root);
+  report.mAfter = report.mBefore;
+
+  DfaLayout layout;
+  if (!layout.Build(root))
+    return report;
+
+  size_t stateCount = layout.mStates.size();
+  size_t classCount = layout.mClassCount;
+
+  // Reverse edges for every class: which states move into a given state on that class
+  std::vector<std::vector<uint16_t>> incoming(classCount * stateCount);
+  for (size_t i = 0; i < stateCount; ++i)
+  {
+    for (size_t c = 0; c < classCount; ++c)
+      incoming[c * stateCount + layout.NextForClass(i, c)].push_back((uint16_t)i);
+  }
+
+  // The initial partition keeps the dead state alone (walking into a non-accepting state still
+  // consumes input, so it is observably different from dying), all other non-accepting states
+  // together, and one block per distinct accepting token
+  std::vector<std::vector<uint16_t>> blocks;
+  std::vector<size_t> blockOf(stateCount, 0);
+  std::unordered_map<int, size_t> blockByToken;
+  blocks.push_back({ DfaTable::cDeadState });
+  for (size_t i = DfaTable::cStartState; i < stateCount; ++i)
+  {
+    auto result = blockByToken.insert(std::make_pair(layout.mStates[i]->mAcceptingToken, blocks.size()));
+    if (result.second)
+      blocks.emplace_back();
+    blockOf[i] = result.first->second;
+    blocks[blockOf[i]].push_back((uint16_t)i);
+  }
+
+  // Hopcroft partition refinement: every block starts out as a splitter
+  std::vector<size_t> worklist;
+  std::vector<bool> inWorklist(blocks.size(), true);
+  for (size_t b = 0; b < blocks.size(); ++b)
+    worklist.push_back(b);
+
+  std::vector<size_t> hitCount;
+  std::vector<bool> hit(stateCount, false);
+  while (!worklist.empty())
+  {
+    size_t splitterIndex = worklist.back();
+    worklist.pop_back();
+    inWorklist[splitterIndex] = false;
+    // Copy the splitter since it may be split itself while we process it
+    std::vector<uint16_t> splitter = blocks[splitterIndex];
+
+    for (size_t c = 0; c < classCount; ++c)
+    {
+      // Find every state that moves into the splitter on this class
+      std::vector<uint16_t> predecessors;
+      for (uint16_t target : splitter)
+      {
+        for (uint16_t source : incoming[c * stateCount + target])
+        {
+          if (!hit[source])
+          {
+            hit[source] = true;
+            predecessors.push_back(source);
+          }
+        }
+      }
+
+      hitCount.assign(blocks.size(), 0);
+      for (uint16_t state : predecessors)
+        ++hitCount[blockOf[state]];
+
+      // Split any block that only partially moves into the splitter
+      std::vector<size_t> touched;
+      for (uint16_t state : predecessors)
+      {
+        size_t b = blockOf[state];
+        if (hitCount[b] != 0 && hitCount[b] != blocks[b].size())
+        {
+          touched.push_back(b);
+          hitCount[b] = 0;
+        }
+      }
+
+      for (size_t b : touched)
+      {
+        std::vector<uint16_t> inside;
+        std::vector<uint16_t> outside;
+        for (uint16_t state : blocks[b])
+        {
+          if (hit[state])
+            inside.push_back(state);
+          else
+            outside.push_back(state);
+        }
+
+        size_t newBlock = blocks.size();
+        blocks[b] = std::move(outside);
+        blocks.push_back(std::move(inside));
+        for (uint16_t state : blocks[newBlock])
+          blockOf[state] = newBlock;
+
+        // If the old block was still waiting, both halves must be processed, otherwise the smaller half is enough
+        bool newIsSmaller = blocks[newBlock].size() <= blocks[b].size();
+        inWorklist.push_back(false);
+        if (inWorklist[b] || newIsSmaller)
+        {
+          worklist.push_back(newBlock);
+          inWorklist[newBlock] = true;
+        }
+        else
+        {
+          worklist.push_back(b);
+          inWorklist[b] = true;
+        }
+      }
+
+      for (uint16_t state : predecessors)
+        hit[state] = false;
+    }
+  }
+
+  // Pick one state per block (the root always represents its own block) and point every edge at it
+  std::vector<DfaState*> representatives(blocks.size(), nullptr);
+  representatives[blockOf[DfaTable::cStartState]] = root;
+  for (size_t i = DfaTable::cStartState; i < stateCount; ++i)
+  {
+    if (representatives[blockOf[i]] == nullptr)
+      representatives[blockOf[i]] = layout.mStates[i];
+  }
+
+  for (size_t i = DfaTable::cStartState; i < stateCount; ++i)
+  {
+    DfaState* state = layout.mStates[i];
+    if (representatives[blockOf[i]] != state)
+      continue;
+    for (auto&& pair : state->mEdges)
+      pair.second = representatives[blockOf[layout.mIds[pair.second]]];
+  }
+
+  for (size_t i = DfaTable::cStartState; i < stateCount; ++i)
+  {
+    if (representatives[blockOf[i]] != layout.mStates[i])
+      delete layout.mStates[i];
+  }
+
+  report.mAfter = GetDfaStatistics(root);
+  return report;
+}
+
+size_t ReadTableToken(const DfaTable& table, const char* stream, Token& outToken)
+{
+  const uint8_t* byteClasses = table.mByteClasses;
+  const uint16_t* transitions = table.mTransitions;
+  const int* acceptingTokens = table.mAcceptingTokens;
+  const DfaLoop* loops = table.mLoops;
+  size_t classCount = table.mClassCount;
+  size_t state = DfaTable::cStartState;
+  size_t index = 0;
+  size_t acceptedIndex = 0;
+  int acceptedToken = 0;
+
+  while (stream[index] != 0)
+  {
+    state = transitions[state * classCount + byteClasses[(unsigned char)stream[index]]];
+    if (state == DfaTable::cDeadState)
+      break;
+
+    ++index;
+    // Skip the rest of a run that stays in this state (whitespace, identifier bodies, comments, ...) in one go
+    if (loops[state].mKind != DfaLoop::None)
+      index = loops[state].Skip(stream, index);
+
+    if (acceptingTokens[state] != 0)
+    {
+      acceptedToken = acceptingTokens[state];
+      acceptedIndex = index;
+    }
+  }
+
+  outToken.mLength = index;
+  outToken.mText = stream;
+  if (acceptedToken != 0)
+  {
+    outToken.mTokenType = acceptedToken;
+    outToken.mLength = acceptedIndex;
+  }
+  return index;
+}
+
 void ReadToken(DfaState* startingState, const char* stream, Token& outToken)
 {
+  if (startingState->mTable != nullptr)
+  {
+    ReadTableToken(*startingState->mTable, stream, outToken);
+    return;
+  }
+
   DfaState* acceptingState = nullptr;
   DfaState* state = startingState;
   size_t index = 0;
@@ -100,208 +408,113 @@ void ReadToken(DfaState* startingState, const char* stream, Token& outToken)
   }
 }
 
-void DeleteStateAndChildren(DfaState* root)
+// Only reads the graph (marking nothing on the states), so a graph is never modified on its way to being deleted
+void CollectStates(DfaState* root, std::unordered_set<DfaState*>& visited, std::vector<DfaState*>& states)
 {
-  if (root == nullptr || root->mValid == false)
+  if (root == nullptr || !visited.insert(root).second)
     return;
-  root->mValid = false;
+  states.push_back(root);
 
   for (auto&& pair : root->mEdges)
   {
-    DeleteStateAndChildren(pair.second);
+    CollectStates(pair.second, visited, states);
   }
 }
 
-std::unordered_map<std::string, TokenType::Enum> BuildLookupMap()
+void DeleteStateAndChildren(DfaState* root)
 {
-  std::unordered_map<std::string, TokenType::Enum> result;
-#define TOKEN(Name, Value) result.insert(std::make_pair(Value, TokenType::Name));
-#include "../Drivers/TokenKeywords.inl"
-#undef TOKEN
-  return result;
-}
+  // The shared language root is never deleted, so handing it back after every compile is free
+  if (root == GetLanguageRoot())
+    return;
 
-static std::unordered_map<std::string, TokenType::Enum> cLookupMap = BuildLookupMap();
+  // Gather everything first since states (and the root's table) are shared by many edges
+  std::unordered_set<DfaState*> visited;
+  std::vector<DfaState*> states;
+  CollectStates(root, visited, states);
+  for (DfaState* state : states)
+    delete state;
+}
 
 void ReadLanguageToken(DfaState* startingState, const char* stream, Token& outToken)
 {
+  // Keywords are branches of the automaton (see CreateRuleKeywords), so they come out of ReadToken already classified
+#if DIRECT_CODED_SCANNER
+  // The generated scanner is the language DFA itself, so the starting state is not needed
+  (void)startingState;
+  ReadDirectCodedToken(stream, outToken);
+#else
   ReadToken(startingState, stream, outToken);
-  if (outToken.mTokenType == TokenType::Identifier)
-  {
-    std::string str(outToken.mText, outToken.mLength);
-    auto&& it = cLookupMap.find(str);
-    if (it != cLookupMap.end())
-      outToken.mTokenType = it->second;
-  }
+#endif
+  AnnotateLanguageToken(outToken);
 }
 
-void CreateRuleWhitespace(DfaState* root)
+void AnnotateLanguageToken(Token& token)
 {
-  std::array<char, 4> values = { ' ', '\r', '\n', '\t' };
-  DfaState* state = AddState(TokenType::Whitespace);
-  for (size_t i = 0; i < values.size(); ++i)
-  {
-    AddEdge(root, state, values[i]);
-    AddEdge(state, state, values[i]);
-  }
+  if (token.mTokenType == TokenType::Identifier)
+    token.mAtom = StringInterner::GetInstance().Intern(token.mText, token.mLength);
+  else if (token.mTokenType == TokenType::IntegerLiteral)
+    token.mIntegerValue = DecodeIntegerLiteral(token);
+  else if (token.mTokenType == TokenType::FloatLiteral)
+    token.mFloatValue = DecodeFloatLiteral(token);
+  else if (token.mTokenType == TokenType::CharacterLiteral)
+    token.mIntegerValue = DecodeCharacterLiteral(token);
 }
 
-void CreateRuleIdentifier(DfaState* root)
+void AnnotateLanguageTokens(std::vector<Token>& tokens, size_t begin)
 {
-  DfaState* state = AddState(TokenType::Identifier);
-  for (char value = 'a'; value <= 'z'; ++value)
-  {
-    AddEdge(root, state, value);
-    AddEdge(state, state, value);
-  }
-  for (char value = 'A'; value <= 'Z'; ++value)
-  {
-    AddEdge(root, state, value);
-    AddEdge(state, state, value);
-  }
-  AddEdge(root, state, '_');
-  AddEdge(state, state, '_');
-  for (char value = '0'; value <= '9'; ++value)
-    AddEdge(state, state, value);
-}
-
-DfaState* CreateIntRule(DfaState* root)
-{
-  DfaState* intState = AddState(TokenType::IntegerLiteral);
-  for (char value = '0'; value <= '9'; ++value)
-  {
-    AddEdge(root, intState, value);
-    AddEdge(intState, intState, value);
-  }
-  return intState;
-}
-
-DfaState* CreateFloatRule(DfaState* intState)
-{
-  DfaState* dotState = AddState(0);
-  DfaState* eState = AddState(0);
-  DfaState* signState = AddState(0);
-  DfaState* floatState0 = AddState(TokenType::FloatLiteral);
-  DfaState* floatState1 = AddState(TokenType::FloatLiteral);
-  DfaState* floatState2 = AddState(TokenType::FloatLiteral);
-
-  AddEdge(intState, dotState, '.');
-  for (char value = '0'; value <= '9'; ++value)
-  {
-    AddEdge(dotState, floatState0, value);
-    AddEdge(floatState0, floatState0, value);
-  }
-
-  AddEdge(floatState0, eState, 'e');
-  AddEdge(eState, signState, '+');
-  AddEdge(eState, signState, '-');
-  for (char value = '0'; value <= '9'; ++value)
-  {
-    AddEdge(eState, floatState1, value);
-    AddEdge(signState, floatState1, value);
-    AddEdge(floatState1, floatState1, value);
-  }
-  AddEdge(floatState1, floatState2, 'f');
-  AddEdge(floatState0, floatState2, 'f');
-  return floatState2;
+  for (size_t i = begin; i < tokens.size(); ++i)
+    AnnotateLanguageToken(tokens[i]);
 }
 
-void BuildTokenRule(DfaState* root, TokenType::Enum tokenType, char* str)
+DfaState* BuildLanguageDfa(DfaMinimizeReport* reportOut)
 {
-  DfaState* state = root;
-  while (str != nullptr && *str != '\0')
-  {
-    char value = *str;
-    DfaState* nextState = state->Find(value);
-    if (nextState == nullptr)
-    {
-      nextState = AddState(0);
-      AddEdge(state, nextState, value);
-    }
-    state = nextState;
-    ++str;
-  }
-  state->mAcceptingToken = tokenType;
+  DfaGraphBuilder builder;
+  DfaState* root = AddState(0);
+  BuildLanguageRules(builder, root);
+  DfaMinimizeReport report = MinimizeDfa(root);
+  if (reportOut != nullptr)
+    *reportOut = report;
+  CompileDfa(root);
+  return root;
 }
 
-void BuildTokenRules(DfaState* root)
-{
-
-#define TOKEN(Name, Value) BuildTokenRule(root, TokenType::Name, Value);
-#include "../Drivers/TokenSymbols.inl"
-#undef TOKEN
-}
+const size_t cStaticDfaCapacity = 1024;
 
-DfaState* StringLiteralRule(DfaState* root, TokenType::Enum tokenType, char delimiterChar)
+constexpr StaticDfaBuilder<cStaticDfaCapacity> BuildStaticLanguageDfa()
 {
-  DfaState* begin = AddState(0);
-  DfaState* charState = AddState(0);
-  DfaState* startEscapeState = AddState(0);
-  DfaState* badEscapeState = AddState(0);
-  DfaState* end = AddState(tokenType);
-  AddEdge(root, begin, delimiterChar);
-  AddDefaultEdge(begin, charState);
-  AddDefaultEdge(charState, charState);
-  AddEdge(charState, startEscapeState, '\\');
-  AddEdge(startEscapeState, charState, 'n');
-  AddEdge(startEscapeState, charState, 'r');
-  AddEdge(startEscapeState, charState, 't');
-  AddEdge(startEscapeState, charState, delimiterChar);
-  AddEdge(charState, end, delimiterChar);
-  return end;
+  StaticDfaBuilder<cStaticDfaCapacity> builder;
+  auto root = builder.AddState(0);
+  BuildLanguageRules(builder, root);
+  builder.ResolveDefaultEdges();
+  return builder;
 }
 
-DfaState* StringLiteralRule(DfaState* root)
-{
-  return StringLiteralRule(root, TokenType::StringLiteral, '\"');
-}
+// Everything below is evaluated by the compiler, only the final arrays end up in the executable (in read-only memory)
+static constexpr StaticDfaBuilder<cStaticDfaCapacity> cStaticLanguageBuilder = BuildStaticLanguageDfa();
+static constexpr StaticDfaClasses<cStaticDfaCapacity> cStaticLanguageClasses(cStaticLanguageBuilder);
+static constexpr StaticDfaTable<cStaticLanguageBuilder.mStateCount, cStaticLanguageClasses.mClassCount>
+  cStaticLanguageArrays(cStaticLanguageBuilder, cStaticLanguageClasses);
+static constexpr DfaTable cStaticLanguageTable = cStaticLanguageArrays.GetTable();
 
-void CommentRule(DfaState* root)
+const DfaTable& GetStaticLanguageTable()
 {
-  DfaState* firstSlash = root->Find('/');
-  DfaState* singleCommentBody = AddState(0);
-  DfaState* singleCommentEnd = AddState(TokenType::SingleLineComment);
-  DfaState* multiCommentBody = AddState(0);
-  DfaState* multiCommentStar = AddState(0);
-  DfaState* multiCommentEnd = AddState(TokenType::MultiLineComment);
-
-  AddEdge(root, firstSlash, '/');
-
-  AddEdge(firstSlash, singleCommentBody, '/');
-  AddDefaultEdge(singleCommentBody, singleCommentBody);
-  AddEdge(singleCommentBody, singleCommentEnd, '\r');
-  AddEdge(singleCommentBody, singleCommentEnd, '\n');
-  AddEdge(singleCommentBody, singleCommentEnd, '\0');
-
-  AddEdge(firstSlash, multiCommentBody, '*');
-  AddDefaultEdge(multiCommentBody, multiCommentBody);
-  AddEdge(multiCommentBody, multiCommentStar, '*');
-  AddDefaultEdge(multiCommentStar, multiCommentBody);
-  AddEdge(multiCommentStar, multiCommentEnd, '/');
+  return cStaticLanguageTable;
 }
 
-DfaState* CharLiteralRule(DfaState* root)
+DfaState* GetLanguageRoot()
 {
-  DfaState* begin = AddState(0);
-  DfaState* charState = AddState(0);
-  DfaState* end = AddState(TokenType::CharacterLiteral);
-  AddEdge(root, begin, '\'');
-  AddDefaultEdge(begin, charState);
-  AddDefaultEdge(charState, charState);
-  AddEdge(charState, end, '\'');
-  return end;
+  // Initialized once (thread safe) and only ever read afterwards
+  static DfaState root = []()
+  {
+    DfaState state;
+    state.mTable = &GetStaticLanguageTable();
+    return state;
+  }();
+  return &root;
 }
 
 DfaState* CreateLanguageDfa()
 {
-  DfaState* root = AddState(0);
-  CreateRuleWhitespace(root);
-  CreateRuleIdentifier(root);
-  DfaState* intRule = CreateIntRule(root);
-  DfaState* floatRule = CreateFloatRule(intRule);
-  BuildTokenRules(root);
-  StringLiteralRule(root);
-  CharLiteralRule(root);
-  CommentRule(root);
-  return root;
+  // Every caller shares one root over the static table, so creating (and deleting) the language DFA costs nothing
+  return GetLanguageRoot();
 }
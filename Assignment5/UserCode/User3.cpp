@@ -14,9 +14,7 @@ void RemoveWhitespaceAndComments(std::vector<Token>& tokens)
   size_t j = 0;
   while (j < tokens.size())
   {
-    auto&& tokenType = tokens[j].mTokenType;
-    bool skip = tokenType == TokenType::Whitespace || tokenType == TokenType::SingleLineComment || tokenType == TokenType::MultiLineComment;
-    if (!skip)
+    if (!TokenStream::IsTrivia(tokens[j].mTokenType))
     {
       tokens[i] = tokens[j];
       ++i;
@@ -48,6 +46,55 @@ std::unique_ptr<BlockNode> ParseBlock(std::vector<Token>& tokens)
   return parser.Block();
 }
 
+std::unique_ptr<ExpressionNode> ParseExpression(TokenStream& stream)
+{
+  Parser parser;
+  parser.Load(stream);
+  return parser.Expression();
+}
+
+std::unique_ptr<BlockNode> ParseBlock(TokenStream& stream)
+{
+  Parser parser;
+  parser.Load(stream);
+  return parser.Block();
+}
+
+std::unique_ptr<ExpressionNode> ParseExpression(const TokenBuffer& buffer)
+{
+  // Only built if the parse fails
+  LineIndex lineIndex(buffer.mText);
+  Parser parser;
+  parser.Load(buffer);
+  parser.SetLineIndex(&lineIndex);
+  return parser.Expression();
+}
+
+std::unique_ptr<BlockNode> ParseBlock(const TokenBuffer& buffer)
+{
+  // Only built if the parse fails
+  LineIndex lineIndex(buffer.mText);
+  Parser parser;
+  parser.Load(buffer);
+  parser.SetLineIndex(&lineIndex);
+  return parser.Block();
+}
+
+std::unique_ptr<BlockNode> ParseBlock(const std::shared_ptr<const SourceFile>& file)
+{
+  // SourceFile::Load hands back null for a file it couldn't open
+  if (file == nullptr)
+    throw ParsingException("Unable to open the source file");
+
+  TokenBuffer buffer(file->GetText());
+  if (!TokenizeStream(LanguageScanner::GetInstance().GetTable(), file->GetText(), buffer, true))
+    throw ParsingException("The source file is too large to tokenize");
+
+  std::unique_ptr<BlockNode> result = ParseBlock(buffer);
+  result->mSource = file;
+  return result;
+}
+
 
 #define VisitAndWalkBase(visitor)\
 if (visit && visitor->Visit(this) == Stop) \
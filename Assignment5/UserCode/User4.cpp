@@ -107,16 +107,23 @@ void SemanticAnalyize(AbstractNode* node, Library* library)
 {
   TypeVisitor typeVisitor(library);
   node->Walk(&typeVisitor);
-  TypeResolverVisitor typeResolverVisitor(library);
+  // Every type a name can refer to exists now
+  SymbolIndex symbolIndex;
+  symbolIndex.AddGlobals(library);
+  TypeResolverVisitor typeResolverVisitor(library, &symbolIndex);
   node->Walk(&typeResolverVisitor);
-  MemberResolverVisitor memberResolverVisitor(library);
+  MemberResolverVisitor memberResolverVisitor(library, &symbolIndex);
   node->Walk(&memberResolverVisitor);
-  ExpresionResolverVisitor expresionResolverVisitor(library);
+  ExpresionResolverVisitor expresionResolverVisitor(library, &symbolIndex);
   node->Walk(&expresionResolverVisitor);
 }
 
 void PrintTreeWithSymbols(AbstractNode* node)
 {
+  // Printing is all this does, so there is nothing to walk when the output goes nowhere
+  if (!GetDiagnosticSink().IsEnabled())
+    return;
+
   SymbolPrinterVisitor visitor;
   node->Walk(&visitor);
 }
@@ -7,7 +7,13 @@
 
 void InterpreterPrePass(AbstractNode* node)
 {
-  InterpreterPrePassVisitor visitor(InterpreterFunctionCall);
+  // The pool belongs to the tree, so the strings live exactly as long as the literal nodes pointing at them
+  BlockNode* block = dynamic_cast<BlockNode*>(node);
+  ErrorIf(block == nullptr, "The pre-pass runs on the root of a parsed tree");
+  if (block->mConstants == nullptr)
+    block->mConstants = std::make_shared<ConstantPool>();
+
+  InterpreterPrePassVisitor visitor(InterpreterFunctionCall, block->mConstants.get());
   node->Walk(&visitor);
 }
 